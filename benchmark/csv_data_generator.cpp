@@ -0,0 +1,166 @@
+#include "csv_data_generator.hpp"
+
+namespace duckdb {
+
+string CsvBenchmarkShape::GetSchema() const {
+	vector<string> entries;
+	for (idx_t i = 0; i < columns.size(); i++) {
+		entries.push_back(StringUtil::Format("'c%llu': '%s'", i, columns[i].type.ToString()));
+	}
+	return "{" + StringUtil::Join(entries, ", ") + "}";
+}
+
+string CsvBenchmarkShape::GetAttachSchema() const {
+	vector<string> entries;
+	for (idx_t i = 0; i < columns.size(); i++) {
+		entries.push_back(StringUtil::Format("\"c%llu\": \"%s\"", i, columns[i].type.ToString()));
+	}
+	return "{" + StringUtil::Join(entries, ", ") + "}";
+}
+
+string CsvBenchmarkShape::GetSelectList() const {
+	vector<string> entries {"count(*)"};
+	for (idx_t i = 0; i < columns.size(); i++) {
+		entries.push_back(StringUtil::Format("min(c%llu)", i));
+	}
+	return StringUtil::Join(entries, ", ");
+}
+
+vector<LogicalType> CsvBenchmarkShape::GetTypes() const {
+	vector<LogicalType> types;
+	for (auto &column : columns) {
+		types.push_back(column.type);
+	}
+	return types;
+}
+
+vector<CsvBenchmarkShape> CsvBenchmarkShape::GetDefaultShapes() {
+	vector<CsvBenchmarkShape> shapes;
+	shapes.push_back({"numeric_4",
+	                  {{LogicalType::BIGINT}, {LogicalType::DOUBLE}, {LogicalType::INTEGER}, {LogicalType::DOUBLE}}});
+	shapes.push_back({"mixed_8",
+	                  {{LogicalType::BIGINT},
+	                   {LogicalType::DOUBLE},
+	                   {LogicalType::VARCHAR, 8},
+	                   {LogicalType::DATE},
+	                   {LogicalType::BOOLEAN},
+	                   {LogicalType::DECIMAL(10, 2)},
+	                   {LogicalType::TIMESTAMP},
+	                   {LogicalType::VARCHAR, 24}}});
+	CsvBenchmarkShape strings {"strings_16x64", {}};
+	for (idx_t i = 0; i < 16; i++) {
+		strings.columns.push_back({LogicalType::VARCHAR, 64});
+	}
+	shapes.push_back(std::move(strings));
+	CsvBenchmarkShape wide {"integers_64", {}};
+	for (idx_t i = 0; i < 64; i++) {
+		wide.columns.push_back({LogicalType::INTEGER});
+	}
+	shapes.push_back(std::move(wide));
+	return shapes;
+}
+
+void CsvDataGenerator::Generate(FileSystem &fs, const string &path, const CsvBenchmarkShape &shape, idx_t size) {
+	if (fs.FileExists(path)) {
+		return;
+	}
+	// The rows go into a temporary file first, so that an interrupted run does not leave a short file behind
+	auto temp_path = path + ".tmp";
+	auto handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+	static constexpr idx_t WRITE_SIZE = 1 << 20;
+	string buffer;
+	idx_t written = 0;
+	while (written + buffer.size() < size) {
+		AppendRow(shape, buffer);
+		if (buffer.size() >= WRITE_SIZE) {
+			handle->Write((void *)buffer.data(), buffer.size());
+			written += buffer.size();
+			buffer.clear();
+		}
+	}
+	handle->Write((void *)buffer.data(), buffer.size());
+	handle->Sync();
+	handle->Close();
+	fs.MoveFile(temp_path, path);
+}
+
+string CsvDataGenerator::GenerateRows(const CsvBenchmarkShape &shape, idx_t size) {
+	string result;
+	result.reserve(size + 4096);
+	while (result.size() < size) {
+		AppendRow(shape, result);
+	}
+	return result;
+}
+
+void CsvDataGenerator::AppendRow(const CsvBenchmarkShape &shape, string &out) {
+	for (idx_t i = 0; i < shape.columns.size(); i++) {
+		if (i > 0) {
+			out += ',';
+		}
+		AppendValue(shape.columns[i], out);
+	}
+	out += '\n';
+}
+
+void CsvDataGenerator::AppendPadded(int64_t value, idx_t width, string &out) {
+	auto digits = std::to_string(value);
+	if (digits.size() < width) {
+		out.append(width - digits.size(), '0');
+	}
+	out += digits;
+}
+
+void CsvDataGenerator::AppendValue(const CsvBenchmarkColumn &column, string &out) {
+	static constexpr char ALPHABET[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+	switch (column.type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		out += NextInt(0, 1) ? "true" : "false";
+		break;
+	case LogicalTypeId::SMALLINT:
+		out += std::to_string(NextInt(NumericLimits<int16_t>::Minimum(), NumericLimits<int16_t>::Maximum()));
+		break;
+	case LogicalTypeId::INTEGER:
+		out += std::to_string(NextInt(NumericLimits<int32_t>::Minimum(), NumericLimits<int32_t>::Maximum()));
+		break;
+	case LogicalTypeId::BIGINT:
+		out += std::to_string(NextInt(-1000000000000, 1000000000000));
+		break;
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		out += std::to_string(NextInt(-1000000, 1000000));
+		out += '.';
+		AppendPadded(NextInt(0, 999), 3, out);
+		break;
+	case LogicalTypeId::DECIMAL:
+		out += std::to_string(NextInt(-99999999, 99999999));
+		out += '.';
+		AppendPadded(NextInt(0, 99), 2, out);
+		break;
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+		AppendPadded(NextInt(1970, 2037), 4, out);
+		out += '-';
+		AppendPadded(NextInt(1, 12), 2, out);
+		out += '-';
+		AppendPadded(NextInt(1, 28), 2, out);
+		if (column.type.id() == LogicalTypeId::TIMESTAMP) {
+			out += ' ';
+			AppendPadded(NextInt(0, 23), 2, out);
+			out += ':';
+			AppendPadded(NextInt(0, 59), 2, out);
+			out += ':';
+			AppendPadded(NextInt(0, 59), 2, out);
+		}
+		break;
+	case LogicalTypeId::VARCHAR:
+		for (idx_t i = 0; i < column.string_length; i++) {
+			out += ALPHABET[NextInt(0, sizeof(ALPHABET) - 2)];
+		}
+		break;
+	default:
+		throw NotImplementedException("Cannot generate values of type %s", column.type.ToString());
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_data_generator.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <random>
+
+namespace duckdb {
+
+//! A column of a synthetic CSV file; VARCHAR values have `string_length` characters
+struct CsvBenchmarkColumn {
+	LogicalType type;
+	idx_t string_length = 0;
+};
+
+//! The shape of a synthetic CSV file: the columns and their types
+struct CsvBenchmarkShape {
+	string name;
+	vector<CsvBenchmarkColumn> columns;
+
+	//! The schema param of scan_csv_ex and the columns param of read_csv, e.g., {'c0': 'BIGINT'}
+	string GetSchema() const;
+	//! The schema of the ATTACH connection string, e.g., {"c0": "BIGINT"}
+	string GetAttachSchema() const;
+	//! The select list of the benchmark queries: the row count and an aggregate of every column, so that every field
+	//! is converted
+	string GetSelectList() const;
+	vector<LogicalType> GetTypes() const;
+
+	//! The shapes that the end-to-end benchmarks scan: narrow numeric rows, mixed types, long strings, and wide rows
+	static vector<CsvBenchmarkShape> GetDefaultShapes();
+};
+
+//! Writes synthetic CSV files with random values. Values are drawn from a fixed seed, so a file of a shape and size
+//! always has the same contents and is generated only once.
+class CsvDataGenerator {
+public:
+	explicit CsvDataGenerator(uint64_t seed = 42) : rng(seed) {
+	}
+
+	//! Writes rows of the shape into `path` until it has at least `size` bytes, unless the file already exists
+	void Generate(FileSystem &fs, const string &path, const CsvBenchmarkShape &shape, idx_t size);
+
+	//! Returns rows of the shape with at least `size` bytes, which is a block for the microbenchmarks
+	string GenerateRows(const CsvBenchmarkShape &shape, idx_t size);
+
+	//! Appends a row of random values, including its newline
+	void AppendRow(const CsvBenchmarkShape &shape, string &out);
+
+	//! Appends a random value of the column
+	void AppendValue(const CsvBenchmarkColumn &column, string &out);
+
+private:
+	int64_t NextInt(int64_t min, int64_t max) {
+		return std::uniform_int_distribution<int64_t>(min, max)(rng);
+	}
+
+	//! Appends `value` with at least `width` digits
+	static void AppendPadded(int64_t value, idx_t width, string &out);
+
+	std::mt19937_64 rng;
+};
+
+} // namespace duckdb
@@ -0,0 +1,324 @@
+#include "csv_data_generator.hpp"
+#include "csv_scanner.hpp"
+
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/main/config.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+extern "C" void csv_scanner_init(duckdb::DatabaseInstance &db);
+
+namespace duckdb {
+
+//! csv_scanner_benchmark measures the throughput of the extension on synthetic files generated into a data directory
+//! (once per shape and size):
+//!  - end to end: scan_csv_ex, ATTACH, and read_csv over every shape, size, thread count, and buffer size
+//!  - micro: building the structural index and walking it with FindNextTargetChar, and CsvReader::Flush per type
+struct CsvBenchmarkOptions {
+	string data_dir = "csv_scanner_benchmark_data";
+	vector<idx_t> sizes;
+	vector<idx_t> threads;
+	vector<idx_t> buffer_sizes;
+	vector<string> paths {"scan_csv_ex", "attach", "read_csv"};
+	vector<string> shapes;
+	idx_t repetitions = 3;
+	bool end_to_end = true;
+	bool micro = true;
+};
+
+static void PrintUsage() {
+	fprintf(stderr,
+	        "Usage: csv_scanner_benchmark [options]\n"
+	        "  --data-dir DIR         where the generated files are kept (default: csv_scanner_benchmark_data)\n"
+	        "  --sizes LIST           file sizes (default: 1MB,100MB,1GB; 10GB is opt-in)\n"
+	        "  --threads LIST         thread counts (default: powers of two up to the number of cores)\n"
+	        "  --buffer-sizes LIST    buffer_size values; auto is the adaptive default (default: auto,1MB,8MB,32MB)\n"
+	        "  --paths LIST           any of scan_csv_ex,attach,read_csv (default: all)\n"
+	        "  --shapes LIST          any of numeric_4,mixed_8,strings_16x64,integers_64 (default: all)\n"
+	        "  --repetitions N        timed runs per measurement, after a warm-up run (default: 3)\n"
+	        "  --micro-only           only run the microbenchmarks\n"
+	        "  --end-to-end-only      only run the end-to-end benchmarks\n");
+}
+
+//! Parses a list of sizes, where `auto` is 0
+static vector<idx_t> ParseSizes(const string &arg) {
+	vector<idx_t> result;
+	for (auto &entry : StringUtil::Split(arg, ',')) {
+		result.push_back(entry == "auto" ? 0 : DBConfig::ParseMemoryLimit(entry));
+	}
+	return result;
+}
+
+static vector<idx_t> ParseCounts(const string &arg) {
+	vector<idx_t> result;
+	for (auto &entry : StringUtil::Split(arg, ',')) {
+		result.push_back(std::stoull(entry));
+	}
+	return result;
+}
+
+static CsvBenchmarkOptions ParseOptions(int argc, char **argv) {
+	CsvBenchmarkOptions options;
+	options.sizes = ParseSizes("1MB,100MB,1GB");
+	options.buffer_sizes = ParseSizes("auto,1MB,8MB,32MB");
+	idx_t num_cores = MaxValue<idx_t>(std::thread::hardware_concurrency(), 1);
+	for (idx_t threads = 1; threads < num_cores; threads *= 2) {
+		options.threads.push_back(threads);
+	}
+	options.threads.push_back(num_cores);
+	for (int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		auto has_value = i + 1 < argc;
+		if (arg == "--data-dir" && has_value) {
+			options.data_dir = argv[++i];
+		} else if (arg == "--sizes" && has_value) {
+			options.sizes = ParseSizes(argv[++i]);
+		} else if (arg == "--threads" && has_value) {
+			options.threads = ParseCounts(argv[++i]);
+		} else if (arg == "--buffer-sizes" && has_value) {
+			options.buffer_sizes = ParseSizes(argv[++i]);
+		} else if (arg == "--paths" && has_value) {
+			options.paths = StringUtil::Split(argv[++i], ',');
+		} else if (arg == "--shapes" && has_value) {
+			options.shapes = StringUtil::Split(argv[++i], ',');
+		} else if (arg == "--repetitions" && has_value) {
+			options.repetitions = MaxValue<idx_t>(std::stoull(argv[++i]), 1);
+		} else if (arg == "--micro-only") {
+			options.end_to_end = false;
+		} else if (arg == "--end-to-end-only") {
+			options.micro = false;
+		} else {
+			PrintUsage();
+			exit(arg == "--help" ? 0 : 1);
+		}
+	}
+	return options;
+}
+
+static double GetSeconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double GetMedian(vector<double> values) {
+	std::sort(values.begin(), values.end());
+	return values[values.size() / 2];
+}
+
+static void PrintHeader(const char *title, const char *first_column) {
+	printf("\n# %s\n%-14s %-14s %10s %7s %11s %12s %9s %8s %9s\n", title, first_column, "shape", "size", "threads",
+	       "buffer_size", "rows", "seconds", "GB/s", "Mrows/s");
+}
+
+static void PrintResult(const string &name, const string &shape, idx_t size, idx_t threads, idx_t buffer_size,
+                        idx_t rows, double seconds) {
+	auto buffer = buffer_size == 0 ? string("default") : StringUtil::BytesToHumanReadableString(buffer_size);
+	auto thread_count = threads == 0 ? string("1") : std::to_string(threads);
+	printf("%-14s %-14s %10s %7s %11s %12llu %9.4f %8.3f %9.2f\n", name.c_str(), shape.c_str(),
+	       StringUtil::BytesToHumanReadableString(size).c_str(), thread_count.c_str(), buffer.c_str(),
+	       static_cast<unsigned long long>(rows), seconds, size / seconds / 1e9, rows / seconds / 1e6);
+	fflush(stdout);
+}
+
+static void CheckResult(QueryResult &result) {
+	if (result.HasError()) {
+		throw InvalidInputException(result.GetError());
+	}
+}
+
+//! Runs the query after a warm-up run and returns the median time; `rows` is set to the row count it returns
+static double TimeQuery(Connection &con, const string &query, idx_t repetitions, idx_t &rows) {
+	vector<double> times;
+	for (idx_t i = 0; i <= repetitions; i++) {
+		auto start = std::chrono::steady_clock::now();
+		auto result = con.Query(query);
+		auto seconds = GetSeconds(start);
+		CheckResult(*result);
+		rows = NumericCast<idx_t>(result->GetValue(0, 0).GetValue<int64_t>());
+		if (i > 0) {
+			times.push_back(seconds);
+		}
+	}
+	return GetMedian(times);
+}
+
+//! Returns the buffer_size option of a query or an ATTACH, which is omitted for the default (0)
+static string GetBufferSizeOption(const string &prefix, idx_t buffer_size) {
+	return buffer_size == 0 ? string() : StringUtil::Format("%sbuffer_size=%llu", prefix, buffer_size);
+}
+
+static string GetQuery(const string &path, const CsvBenchmarkShape &shape, const string &file, idx_t buffer_size) {
+	auto select_list = shape.GetSelectList();
+	if (path == "scan_csv_ex") {
+		return StringUtil::Format("SELECT %s FROM scan_csv_ex('%s', %s%s)", select_list, file, shape.GetSchema(),
+		                          GetBufferSizeOption(", ", buffer_size));
+	}
+	if (path == "read_csv") {
+		return StringUtil::Format("SELECT %s FROM read_csv('%s', columns=%s, header=false, auto_detect=false%s)",
+		                          select_list, file, shape.GetSchema(), GetBufferSizeOption(", ", buffer_size));
+	}
+	return StringUtil::Format("SELECT %s FROM csv_benchmark.data", select_list);
+}
+
+static void RunEndToEndBenchmarks(Connection &con, FileSystem &fs, const CsvBenchmarkOptions &options,
+                                  const vector<CsvBenchmarkShape> &shapes) {
+	PrintHeader("end to end", "path");
+	CsvDataGenerator generator;
+	for (auto &shape : shapes) {
+		for (auto size : options.sizes) {
+			auto file = fs.JoinPath(options.data_dir, StringUtil::Format("%s_%llu.csv", shape.name, size));
+			generator.Generate(fs, file, shape, size);
+			auto file_size = fs.OpenFile(file, FileFlags::FILE_FLAGS_READ)->GetFileSize();
+			for (auto &path : options.paths) {
+				for (auto buffer_size : options.buffer_sizes) {
+					if (path == "attach") {
+						CheckResult(*con.Query(StringUtil::Format(
+						    "ATTACH 'file=%s relname=data schema=%s%s' AS csv_benchmark (TYPE CSV_SCANNER)", file,
+						    shape.GetAttachSchema(), GetBufferSizeOption(" ", buffer_size))));
+					}
+					auto query = GetQuery(path, shape, file, buffer_size);
+					for (auto threads : options.threads) {
+						CheckResult(*con.Query(StringUtil::Format("SET threads=%llu", threads)));
+						idx_t rows;
+						auto seconds = TimeQuery(con, query, options.repetitions, rows);
+						PrintResult(path, shape.name, file_size, threads, buffer_size, rows, seconds);
+					}
+					if (path == "attach") {
+						CheckResult(*con.Query("DETACH csv_benchmark"));
+					}
+				}
+			}
+		}
+	}
+}
+
+//! The size of the blocks of the microbenchmarks, which fits in the last-level cache of few machines
+static constexpr idx_t MICRO_BLOCK_SIZE = 8000000;
+
+static void RunStructuralIndexBenchmarks(const CsvBenchmarkOptions &options) {
+	auto title = StringUtil::Format("structural index (%s kernel)", CsvStructuralIndex::GetKernelName());
+	PrintHeader(title.c_str(), "benchmark");
+	CsvDataGenerator generator;
+	CsvDialect dialect;
+	for (auto &shape : CsvBenchmarkShape::GetDefaultShapes()) {
+		auto data = generator.GenerateRows(shape, MICRO_BLOCK_SIZE);
+		auto data_ptr = data.c_str();
+		auto data_size = data.size();
+		CsvStructuralIndex index;
+		vector<double> build_times;
+		for (idx_t i = 0; i < options.repetitions; i++) {
+			auto start = std::chrono::steady_clock::now();
+			index.Build(data_ptr, data_size, dialect, true);
+			build_times.push_back(GetSeconds(start));
+		}
+		// Walk the rows as the row skipping of the line index does, and the fields as a tokenizer would
+		for (auto target : {'\n', ','}) {
+			vector<double> times;
+			idx_t count = 0;
+			for (idx_t i = 0; i < options.repetitions; i++) {
+				count = 0;
+				auto start = std::chrono::steady_clock::now();
+				for (idx_t pos = 0; pos < data_size; count++) {
+					pos += index.FindNextTargetChar(data_ptr, pos, target) + 1;
+				}
+				times.push_back(GetSeconds(start));
+			}
+			PrintResult(target == '\n' ? "find_newline" : "find_delimiter", shape.name, data_size, 0, 0, count,
+			            GetMedian(times));
+		}
+		idx_t rows = std::count(data.begin(), data.end(), '\n');
+		PrintResult("build", shape.name, data_size, 0, 0, rows, GetMedian(build_times));
+	}
+}
+
+static void RunFlushBenchmarks(const CsvBenchmarkOptions &options) {
+	PrintHeader("CsvReader::Flush by type", "mode");
+	CsvDataGenerator generator;
+	CsvDialect dialect;
+	auto pool = make_shared_ptr<CsvBufferPool>(Allocator::DefaultAllocator(), 1, false);
+	vector<CsvBenchmarkColumn> columns {{LogicalType::BOOLEAN},       {LogicalType::SMALLINT},  {LogicalType::INTEGER},
+	                                    {LogicalType::BIGINT},        {LogicalType::FLOAT},     {LogicalType::DOUBLE},
+	                                    {LogicalType::DECIMAL(10, 2)}, {LogicalType::DATE},      {LogicalType::TIMESTAMP},
+	                                    {LogicalType::VARCHAR, 8},    {LogicalType::VARCHAR, 64}};
+	for (auto &column : columns) {
+		CsvBenchmarkShape shape {column.type.ToString(), {column}};
+		if (column.type.id() == LogicalTypeId::VARCHAR) {
+			shape.name += "(" + std::to_string(column.string_length) + ")";
+		}
+		auto data = generator.GenerateRows(shape, MICRO_BLOCK_SIZE);
+		vector<string> names {"c0"};
+		auto types = shape.GetTypes();
+		vector<CsvColumnConverter> converters {CsvColumnConverter::Get(column.type)};
+		vector<column_t> column_ids {0};
+		DataChunk chunk;
+		chunk.Initialize(Allocator::DefaultAllocator(), types);
+		CsvScanStats stats;
+		for (auto columnar : {false, true}) {
+			vector<double> times;
+			idx_t rows = 0;
+			for (idx_t i = 0; i < options.repetitions; i++) {
+				// The reader indexes its block when it is created, which is not part of the conversions
+				auto buffer = make_uniq<CsvFileBuffer>(pool, data.size());
+				memcpy(buffer->internal_buffer, data.data(), data.size());
+				CsvReader reader(0, names, types, converters, dialect, column_ids, optional_ptr<TableFilterSet>(), 0,
+				                 NumericLimits<idx_t>::Maximum(), columnar, stats,
+				                 make_uniq<CsvBlock>(std::move(buffer), data.size()));
+				rows = 0;
+				auto start = std::chrono::steady_clock::now();
+				while (true) {
+					chunk.Reset();
+					reader.Flush(chunk);
+					if (chunk.size() == 0) {
+						break;
+					}
+					rows += chunk.size();
+				}
+				times.push_back(GetSeconds(start));
+			}
+			PrintResult(columnar ? "columns" : "rows", shape.name, data.size(), 0, 0, rows, GetMedian(times));
+		}
+	}
+}
+
+static int RunBenchmarks(int argc, char **argv) {
+	auto options = ParseOptions(argc, argv);
+	auto shapes = CsvBenchmarkShape::GetDefaultShapes();
+	if (!options.shapes.empty()) {
+		vector<CsvBenchmarkShape> selected;
+		for (auto &shape : shapes) {
+			if (std::find(options.shapes.begin(), options.shapes.end(), shape.name) != options.shapes.end()) {
+				selected.push_back(shape);
+			}
+		}
+		shapes = std::move(selected);
+	}
+	DuckDB db(nullptr);
+	csv_scanner_init(*db.instance);
+	Connection con(db);
+	auto &fs = FileSystem::GetFileSystem(*db.instance);
+	if (!fs.DirectoryExists(options.data_dir)) {
+		fs.CreateDirectory(options.data_dir);
+	}
+	if (options.micro) {
+		RunStructuralIndexBenchmarks(options);
+		RunFlushBenchmarks(options);
+	}
+	if (options.end_to_end) {
+		RunEndToEndBenchmarks(con, fs, options, shapes);
+	}
+	return 0;
+}
+
+} // namespace duckdb
+
+int main(int argc, char **argv) {
+	try {
+		return duckdb::RunBenchmarks(argc, argv);
+	} catch (std::exception &ex) {
+		duckdb::ErrorData error(ex);
+		fprintf(stderr, "csv_scanner_benchmark failed: %s\n", error.Message().c_str());
+		return 1;
+	}
+}
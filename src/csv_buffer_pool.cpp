@@ -0,0 +1,65 @@
+#include "csv_buffer_pool.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+static void AdviseHugePages(data_ptr_t buffer, idx_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	// madvise requires a page-aligned range, so only the aligned part of the buffer is advised
+	auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+	auto start = (reinterpret_cast<uintptr_t>(buffer) + page_size - 1) & ~(page_size - 1);
+	auto end = (reinterpret_cast<uintptr_t>(buffer) + size) & ~(page_size - 1);
+	if (start < end) {
+		// This is just a hint, so we ignore errors (e.g., THP disabled in the kernel)
+		madvise(reinterpret_cast<void *>(start), end - start, MADV_HUGEPAGE);
+	}
+#endif
+}
+
+CsvBufferPool::CsvBufferPool(Allocator &allocator, idx_t max_free_buffers, bool use_huge_pages)
+	: allocator(allocator), max_free_buffers(max_free_buffers), use_huge_pages(use_huge_pages) {
+}
+
+CsvBufferPool::~CsvBufferPool() {
+	for (auto &entry : free_buffers) {
+		allocator.FreeData(entry.first, entry.second);
+	}
+}
+
+data_ptr_t CsvBufferPool::Allocate(idx_t size, idx_t &capacity) {
+	{
+		lock_guard<mutex> guard(lock);
+		for (idx_t i = 0; i < free_buffers.size(); i++) {
+			if (free_buffers[i].second >= size) {
+				auto buffer = free_buffers[i].first;
+				capacity = free_buffers[i].second;
+				free_buffers[i] = free_buffers.back();
+				free_buffers.pop_back();
+				return buffer;
+			}
+		}
+	}
+	auto buffer = allocator.AllocateData(size);
+	if (use_huge_pages) {
+		AdviseHugePages(buffer, size);
+	}
+	capacity = size;
+	return buffer;
+}
+
+void CsvBufferPool::Release(data_ptr_t buffer, idx_t capacity) {
+	{
+		lock_guard<mutex> guard(lock);
+		if (free_buffers.size() < max_free_buffers) {
+			free_buffers.emplace_back(buffer, capacity);
+			return;
+		}
+	}
+	allocator.FreeData(buffer, capacity);
+}
+
+} // namespace duckdb
@@ -0,0 +1,73 @@
+#include "csv_cardinality.hpp"
+
+namespace duckdb {
+
+//! Counts the non-empty lines in [start, end), which are the rows the scanner returns
+static idx_t CountRows(const char *data, idx_t start, idx_t end) {
+	idx_t row_count = 0;
+	idx_t pos = start;
+	while (pos < end) {
+		if (data[pos] != '\n') {
+			row_count++;
+		}
+		auto newline = static_cast<const char *>(memchr(data + pos, '\n', end - pos));
+		if (!newline) {
+			break;
+		}
+		pos = newline - data + 1;
+	}
+	return row_count;
+}
+
+idx_t CsvCardinalityEstimator::EstimateRows(FileHandle &handle) {
+	if (!handle.CanSeek() || handle.IsPipe()) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto file_size = handle.GetFileSize();
+	if (file_size == 0) {
+		return 0;
+	}
+	auto sample_size = MinValue<idx_t>(SAMPLE_SIZE, file_size);
+	// The samples are evenly spaced; the first one starts at the head of the file and the last one ends at its tail
+	auto num_samples = MinValue<idx_t>(NUM_SAMPLES, (file_size + sample_size - 1) / sample_size);
+	auto buffer = make_unsafe_uniq_array<char>(sample_size);
+	auto data = buffer.get();
+
+	idx_t sampled_bytes = 0;
+	idx_t sampled_rows = 0;
+	for (idx_t i = 0; i < num_samples; i++) {
+		auto offset = num_samples == 1 ? 0 : (file_size - sample_size) * i / (num_samples - 1);
+		handle.Read(data, sample_size, offset);
+
+		// Only complete rows are counted: from the first row starting in the sample to the last newline in it
+		idx_t start = 0;
+		if (offset > 0) {
+			auto newline = static_cast<const char *>(memchr(data, '\n', sample_size));
+			if (!newline) {
+				continue;
+			}
+			start = newline - data + 1;
+		}
+		auto end = sample_size;
+		if (offset + sample_size < file_size) {
+			while (end > start && data[end - 1] != '\n') {
+				end--;
+			}
+		}
+		sampled_bytes += end - start;
+		sampled_rows += CountRows(data, start, end);
+	}
+
+	if (sample_size == file_size) {
+		// The single sample is the whole file
+		return sampled_rows;
+	}
+	if (sampled_rows == 0) {
+		// No row fits in a sample, so there are at most this many rows
+		return MaxValue<idx_t>(1, file_size / sample_size);
+	}
+	return static_cast<idx_t>(static_cast<double>(file_size) * static_cast<double>(sampled_rows) /
+	                          static_cast<double>(sampled_bytes));
+}
+
+} // namespace duckdb
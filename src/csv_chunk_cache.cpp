@@ -0,0 +1,102 @@
+#include "csv_chunk_cache.hpp"
+
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+CsvChunkCache::CsvChunkCache(vector<CsvFileSignature> signatures_p, const vector<LogicalType> &column_types_p,
+                             const CsvDialect &dialect_p, unique_ptr<ColumnDataCollection> collection_p)
+	: signatures(std::move(signatures_p)), column_types(column_types_p), dialect(dialect_p),
+	  collection(std::move(collection_p)) {
+}
+
+vector<CsvFileSignature> CsvChunkCache::GetSignatures(ClientContext &context, const vector<string> &files) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	vector<CsvFileSignature> result;
+	for (auto &path : files) {
+		auto file_handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		result.push_back(CsvFileSignature::Get(*file_handle));
+	}
+	return result;
+}
+
+shared_ptr<CsvChunkCache> CsvChunkCache::TryGet(ClientContext &context, const vector<string> &files,
+                                                const vector<LogicalType> &column_types, const CsvDialect &dialect) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto chunk_cache = cache.Get<CsvChunkCache>(GetKey(files));
+	if (!chunk_cache || chunk_cache->column_types != column_types || !(chunk_cache->dialect == dialect)) {
+		return nullptr;
+	}
+	// Opening the files is far cheaper than parsing them again
+	auto signatures = GetSignatures(context, files);
+	for (idx_t i = 0; i < signatures.size(); i++) {
+		if (!(signatures[i] == chunk_cache->signatures[i])) {
+			return nullptr;
+		}
+	}
+	return chunk_cache;
+}
+
+CsvChunkCacheBuilder::CsvChunkCacheBuilder(ClientContext &context, const vector<string> &files_p,
+                                           const vector<LogicalType> &column_types_p, const CsvDialect &dialect_p)
+	: cache(ObjectCache::GetObjectCache(context)), files(files_p),
+	  signatures(CsvChunkCache::GetSignatures(context, files)), column_types(column_types_p), dialect(dialect_p),
+	  max_size(static_cast<idx_t>(BufferManager::GetBufferManager(context).GetMaxMemory() *
+	                              CsvChunkCache::MAX_MEMORY_RATIO)),
+	  buffer_manager(BufferManager::GetBufferManager(context)), size(0), given_up(false) {
+}
+
+void CsvChunkCacheBuilder::Append(CsvChunkCacheBatch &batch, idx_t batch_index, DataChunk &chunk) {
+	if (given_up) {
+		batch.collection.reset();
+		return;
+	}
+	if (!batch.collection || batch.batch_index != batch_index) {
+		FinishBatch(batch);
+		batch.batch_index = batch_index;
+		batch.collection = make_uniq<ColumnDataCollection>(buffer_manager, column_types);
+	}
+	auto batch_size = batch.collection->SizeInBytes();
+	batch.collection->Append(chunk);
+	auto appended_size = batch.collection->SizeInBytes() - batch_size;
+
+	lock_guard<mutex> guard(lock);
+	if (given_up) {
+		batch.collection.reset();
+		return;
+	}
+	size += appended_size;
+	if (size > max_size) {
+		// The table does not fit, so it is parsed on every scan as usual
+		batches.clear();
+		batch.collection.reset();
+		given_up = true;
+	}
+}
+
+void CsvChunkCacheBuilder::FinishBatch(CsvChunkCacheBatch &batch) {
+	if (!batch.collection) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (!given_up) {
+		batches[batch.batch_index] = std::move(batch.collection);
+	}
+	batch.collection.reset();
+}
+
+void CsvChunkCacheBuilder::Publish() {
+	lock_guard<mutex> guard(lock);
+	if (given_up) {
+		return;
+	}
+	auto collection = make_uniq<ColumnDataCollection>(buffer_manager, column_types);
+	for (auto &batch : batches) {
+		collection->Combine(*batch.second);
+	}
+	batches.clear();
+	cache.Put(CsvChunkCache::GetKey(files),
+	          make_shared_ptr<CsvChunkCache>(signatures, column_types, dialect, std::move(collection)));
+}
+
+} // namespace duckdb
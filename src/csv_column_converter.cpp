@@ -0,0 +1,145 @@
+#include "csv_column_converter.hpp"
+#include "csv_number_parser.hpp"
+
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/operator/decimal_cast_operators.hpp"
+#include "duckdb/function/cast/default_casts.hpp"
+
+namespace duckdb {
+
+static bool ConvertVarchar(const CsvColumnConverter &converter, const char *ptr, idx_t len, Vector &out_vec,
+                           idx_t row) {
+	// Points into the CSV block, which the vector keeps alive through CsvBlockVectorBuffer
+	FlatVector::GetData<string_t>(out_vec)[row] = string_t(ptr, UnsafeNumericCast<uint32_t>(len));
+	return true;
+}
+
+template <class T>
+static bool ConvertInteger(const CsvColumnConverter &converter, const char *ptr, idx_t len, Vector &out_vec,
+                           idx_t row) {
+	int64_t value;
+	if (!CsvNumberParser::TryParseBigint(ptr, len, value) || value < int64_t(NumericLimits<T>::Minimum()) ||
+	    value > int64_t(NumericLimits<T>::Maximum())) {
+		return false;
+	}
+	FlatVector::GetData<T>(out_vec)[row] = static_cast<T>(value);
+	return true;
+}
+
+static bool ConvertDouble(const CsvColumnConverter &converter, const char *ptr, idx_t len, Vector &out_vec,
+                          idx_t row) {
+	return CsvNumberParser::TryParseDouble(ptr, len, FlatVector::GetData<double>(out_vec)[row]);
+}
+
+//! BOOLEAN, FLOAT, DATE, and TIMESTAMP values go to DuckDB's strict casts
+template <class T>
+static bool ConvertCast(const CsvColumnConverter &converter, const char *ptr, idx_t len, Vector &out_vec,
+                        idx_t row) {
+	return TryCast::Operation<string_t, T>(string_t(ptr, UnsafeNumericCast<uint32_t>(len)),
+	                                       FlatVector::GetData<T>(out_vec)[row], true);
+}
+
+//! T is the physical type of the DECIMAL, which depends on its width
+template <class T>
+static bool ConvertDecimal(const CsvColumnConverter &converter, const char *ptr, idx_t len, Vector &out_vec,
+                           idx_t row) {
+	// With an error message to fill, a malformed or out-of-range value fails the cast instead of throwing
+	string error_message;
+	CastParameters parameters(false, &error_message);
+	return TryCastToDecimal::Operation<string_t, T>(string_t(ptr, UnsafeNumericCast<uint32_t>(len)),
+	                                                FlatVector::GetData<T>(out_vec)[row], parameters,
+	                                                converter.width, converter.scale);
+}
+
+template <CsvColumnConverter::convert_function_t FUNCTION>
+static void ConvertFields(const CsvColumnConverter &converter, const char *data_ptr, const idx_t *field_starts,
+                          const idx_t *field_lengths, const SelectionVector &sel, idx_t count, Vector &out_vec) {
+	auto &validity = FlatVector::Validity(out_vec);
+	for (idx_t i = 0; i < count; i++) {
+		auto row = sel.get_index(i);
+		auto len = field_lengths[row];
+		validity.Set(row, len > 0 && FUNCTION(converter, data_ptr + field_starts[row], len, out_vec, row));
+	}
+}
+
+template <CsvColumnConverter::convert_function_t FUNCTION>
+static void SetFunctions(CsvColumnConverter &converter) {
+	converter.function = FUNCTION;
+	converter.column_function = ConvertFields<FUNCTION>;
+}
+
+bool CsvColumnConverter::IsSupported(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+		return true;
+	default:
+		return false;
+	}
+}
+
+CsvColumnConverter CsvColumnConverter::Get(const LogicalType &type) {
+	CsvColumnConverter converter;
+	switch (type.id()) {
+	case LogicalTypeId::VARCHAR:
+		SetFunctions<ConvertVarchar>(converter);
+		break;
+	case LogicalTypeId::BOOLEAN:
+		SetFunctions<ConvertCast<bool>>(converter);
+		break;
+	case LogicalTypeId::SMALLINT:
+		SetFunctions<ConvertInteger<int16_t>>(converter);
+		break;
+	case LogicalTypeId::INTEGER:
+		SetFunctions<ConvertInteger<int32_t>>(converter);
+		break;
+	case LogicalTypeId::BIGINT:
+		SetFunctions<ConvertInteger<int64_t>>(converter);
+		break;
+	case LogicalTypeId::FLOAT:
+		SetFunctions<ConvertCast<float>>(converter);
+		break;
+	case LogicalTypeId::DOUBLE:
+		SetFunctions<ConvertDouble>(converter);
+		break;
+	case LogicalTypeId::DATE:
+		SetFunctions<ConvertCast<date_t>>(converter);
+		break;
+	case LogicalTypeId::TIMESTAMP:
+		SetFunctions<ConvertCast<timestamp_t>>(converter);
+		break;
+	case LogicalTypeId::DECIMAL:
+		converter.width = DecimalType::GetWidth(type);
+		converter.scale = DecimalType::GetScale(type);
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			SetFunctions<ConvertDecimal<int16_t>>(converter);
+			break;
+		case PhysicalType::INT32:
+			SetFunctions<ConvertDecimal<int32_t>>(converter);
+			break;
+		case PhysicalType::INT64:
+			SetFunctions<ConvertDecimal<int64_t>>(converter);
+			break;
+		case PhysicalType::INT128:
+			SetFunctions<ConvertDecimal<hugeint_t>>(converter);
+			break;
+		default:
+			throw InternalException("Unsupported physical type for DECIMAL: %s", TypeIdToString(type.InternalType()));
+		}
+		break;
+	default:
+		throw BinderException("scan_csv_ex does not support the type %s", type.ToString());
+	}
+	return converter;
+}
+
+} // namespace duckdb
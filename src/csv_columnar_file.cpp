@@ -0,0 +1,371 @@
+#include "csv_columnar_file.hpp"
+#include "csv_zone_map.hpp"
+
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "zstd.h"
+
+namespace duckdb {
+
+//! A sidecar is a series of column chunks, then the footer serialized by the binary serializer of DuckDB, then
+//! a trailer of two uint64 values in the native byte order: the size of the footer and the magic number below.
+static constexpr uint64_t CSV_COLUMNAR_MAGIC = 0x31304C4F43565343; // "CSVCOL01"
+static constexpr idx_t CSV_COLUMNAR_TRAILER_SIZE = 2;
+//! Fast levels compress numbers and repetitive strings well enough; the sidecar is written once per file version
+static constexpr int CSV_COLUMNAR_COMPRESSION_LEVEL = 3;
+
+static void SerializeFooter(Serializer &serializer, const CsvFileSignature &signature,
+                            const vector<LogicalType> &column_types, const CsvDialect &dialect,
+                            const vector<CsvColumnarRowGroup> &row_groups) {
+	serializer.WriteProperty<uint64_t>(100, "file_size", signature.file_size);
+	serializer.WriteProperty<int64_t>(101, "last_modified", signature.last_modified);
+	serializer.WriteProperty<uint8_t>(102, "delimiter", uint8_t(dialect.delimiter));
+	serializer.WriteProperty<uint8_t>(103, "quote", uint8_t(dialect.quote));
+	serializer.WriteProperty<uint8_t>(104, "escape", uint8_t(dialect.escape));
+	serializer.WriteProperty(105, "column_types", column_types);
+	serializer.WriteList(106, "row_groups", row_groups.size(), [&](Serializer::List &list, idx_t i) {
+		auto &row_group = row_groups[i];
+		list.WriteObject([&](Serializer &object) {
+			object.WriteProperty<idx_t>(100, "row_count", row_group.row_count);
+			object.WriteProperty<idx_t>(101, "num_vectors", row_group.num_vectors);
+			object.WriteList(102, "columns", row_group.columns.size(), [&](Serializer::List &columns, idx_t j) {
+				columns.WriteObject([&](Serializer &column) {
+					column.WriteProperty<idx_t>(100, "offset", row_group.columns[j].offset);
+					column.WriteProperty<idx_t>(101, "size", row_group.columns[j].size);
+					column.WriteProperty<idx_t>(102, "decompressed_size", row_group.columns[j].decompressed_size);
+					column.WriteProperty(103, "statistics", row_group.statistics[j]);
+				});
+			});
+		});
+	});
+}
+
+unique_ptr<CsvColumnarFile> CsvColumnarFile::TryOpen(FileSystem &fs, const string &file_path,
+                                                     const CsvFileSignature &signature,
+                                                     const vector<LogicalType> &column_types,
+                                                     const CsvDialect &dialect) {
+	auto path = GetPath(file_path);
+	if (!fs.FileExists(path)) {
+		return nullptr;
+	}
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	auto size = handle->GetFileSize();
+	uint64_t trailer[CSV_COLUMNAR_TRAILER_SIZE];
+	if (size < sizeof(trailer)) {
+		return nullptr;
+	}
+	handle->Read(trailer, sizeof(trailer), size - sizeof(trailer));
+	auto footer_size = trailer[0];
+	if (trailer[1] != CSV_COLUMNAR_MAGIC || footer_size > size - sizeof(trailer)) {
+		return nullptr;
+	}
+	auto footer_offset = size - sizeof(trailer) - footer_size;
+	auto footer = make_unsafe_uniq_array<data_t>(footer_size);
+	handle->Read(footer.get(), footer_size, footer_offset);
+
+	auto result = make_uniq<CsvColumnarFile>();
+	try {
+		MemoryStream stream(footer.get(), footer_size);
+		BinaryDeserializer deserializer(stream);
+		deserializer.Begin();
+		CsvFileSignature sidecar_signature;
+		sidecar_signature.file_size = deserializer.ReadProperty<uint64_t>(100, "file_size");
+		sidecar_signature.last_modified = deserializer.ReadProperty<int64_t>(101, "last_modified");
+		CsvDialect sidecar_dialect;
+		sidecar_dialect.delimiter = char(deserializer.ReadProperty<uint8_t>(102, "delimiter"));
+		sidecar_dialect.quote = char(deserializer.ReadProperty<uint8_t>(103, "quote"));
+		sidecar_dialect.escape = char(deserializer.ReadProperty<uint8_t>(104, "escape"));
+		result->column_types = deserializer.ReadProperty<vector<LogicalType>>(105, "column_types");
+		if (!(sidecar_signature == signature) || !(sidecar_dialect == dialect) ||
+		    result->column_types != column_types) {
+			return nullptr;
+		}
+		idx_t next_row = 0;
+		deserializer.ReadList(106, "row_groups", [&](Deserializer::List &list, idx_t i) {
+			list.ReadObject([&](Deserializer &object) {
+				CsvColumnarRowGroup row_group;
+				row_group.first_row = next_row;
+				row_group.row_count = object.ReadProperty<idx_t>(100, "row_count");
+				row_group.num_vectors = object.ReadProperty<idx_t>(101, "num_vectors");
+				object.ReadList(102, "columns", [&](Deserializer::List &columns, idx_t j) {
+					columns.ReadObject([&](Deserializer &column) {
+						CsvColumnarColumnChunk column_chunk;
+						column_chunk.offset = column.ReadProperty<idx_t>(100, "offset");
+						column_chunk.size = column.ReadProperty<idx_t>(101, "size");
+						column_chunk.decompressed_size = column.ReadProperty<idx_t>(102, "decompressed_size");
+						row_group.columns.push_back(column_chunk);
+						// The statistics of a column are deserialized for its type
+						column.Set<const LogicalType &>(column_types[j]);
+						row_group.statistics.push_back(column.ReadProperty<BaseStatistics>(103, "statistics"));
+						column.Unset<LogicalType>();
+					});
+				});
+				next_row += row_group.row_count;
+				result->row_groups.push_back(std::move(row_group));
+			});
+		});
+		deserializer.End();
+	} catch (std::exception &) {
+		// A broken footer (e.g., from another version of this extension) is a stale sidecar
+		return nullptr;
+	}
+	for (auto &row_group : result->row_groups) {
+		if (row_group.columns.size() != column_types.size()) {
+			return nullptr;
+		}
+		for (auto &column : row_group.columns) {
+			if (column.offset + column.size > footer_offset) {
+				return nullptr;
+			}
+		}
+	}
+	result->handle = std::move(handle);
+	return result;
+}
+
+bool CsvColumnarFile::CanSkip(idx_t row_group_idx, const vector<CsvReaderFilter> &filters) const {
+	auto &statistics = row_groups[row_group_idx].statistics;
+	for (auto &filter : filters) {
+		auto result = filter.filter.get().CheckStatistics(statistics[filter.column_idx]);
+		if (result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+			return true;
+		}
+	}
+	return false;
+}
+
+vector<unique_ptr<DataChunk>> CsvColumnarFile::ReadRowGroup(idx_t row_group_idx, const vector<column_t> &column_ids) {
+	auto &row_group = row_groups[row_group_idx];
+	vector<LogicalType> types;
+	for (auto column_id : column_ids) {
+		types.push_back(column_types[column_id]);
+	}
+	vector<unique_ptr<DataChunk>> result;
+	for (idx_t k = 0; k < row_group.num_vectors; k++) {
+		result.push_back(make_uniq<DataChunk>());
+		result.back()->InitializeEmpty(types);
+	}
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		auto &column = row_group.columns[column_ids[i]];
+		auto compressed = make_unsafe_uniq_array<data_t>(column.size);
+		handle->Read(compressed.get(), column.size, column.offset);
+		auto decompressed = make_unsafe_uniq_array<data_t>(column.decompressed_size);
+		auto decompressed_size = duckdb_zstd::ZSTD_decompress(decompressed.get(), column.decompressed_size,
+		                                                      compressed.get(), column.size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != column.decompressed_size) {
+			throw IOException("Could not decompress a column chunk at offset %llu of %s", column.offset,
+			                  handle->GetPath());
+		}
+		// The deserialized vectors own their data, so the decompressed bytes can go
+		MemoryStream stream(decompressed.get(), column.decompressed_size);
+		BinaryDeserializer deserializer(stream);
+		for (auto &chunk : result) {
+			DataChunk vector_chunk;
+			deserializer.Begin();
+			vector_chunk.Deserialize(deserializer);
+			deserializer.End();
+			chunk->data[i].Reference(vector_chunk.data[0]);
+			chunk->SetCardinality(vector_chunk.size());
+		}
+	}
+	return result;
+}
+
+CsvColumnarWriter::CsvColumnarWriter(FileSystem &fs_p, BufferManager &buffer_manager_p, const string &file_path,
+                                     const CsvFileSignature &signature_p, const vector<LogicalType> &column_types_p,
+                                     const CsvDialect &dialect_p)
+	: fs(fs_p), path(CsvColumnarFile::GetPath(file_path)),
+	  temp_path(path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp"), signature(signature_p),
+	  column_types(column_types_p), dialect(dialect_p), buffer_manager(buffer_manager_p), next_batch_index(0),
+	  combined_batch_index(0), file_offset(0), failed(false), finished(false) {
+	// Concurrent scans may write the same sidecar, so each of them writes its own temporary file
+	handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+}
+
+CsvColumnarWriter::~CsvColumnarWriter() {
+	if (finished) {
+		return;
+	}
+	try {
+		handle.reset();
+		fs.RemoveFile(temp_path);
+	} catch (std::exception &) {
+		// A leftover temporary file is never read
+	}
+}
+
+void CsvColumnarWriter::Append(idx_t batch_index, DataChunk &chunk) {
+	if (failed) {
+		return;
+	}
+	unique_ptr<ColumnDataCollection> full_rows;
+	{
+		lock_guard<mutex> guard(lock);
+		auto &batch = batches[batch_index];
+		if (!batch.rows) {
+			batch.rows = make_uniq<ColumnDataCollection>(buffer_manager, column_types);
+		}
+		batch.rows->Append(chunk);
+		if (batch.rows->Count() >= CsvColumnarFile::ROW_GROUP_SIZE) {
+			full_rows = std::move(batch.rows);
+			batch.wrote_row_group = true;
+		}
+	}
+	if (full_rows) {
+		TryWriteRowGroup(batch_index, *full_rows);
+	}
+}
+
+void CsvColumnarWriter::FinishBatch(idx_t batch_index) {
+	if (failed) {
+		return;
+	}
+	vector<pair<idx_t, unique_ptr<ColumnDataCollection>>> row_groups_to_write;
+	{
+		lock_guard<mutex> guard(lock);
+		// Blocks without rows are finished too, so the blocks after them can be combined
+		batches[batch_index].finished = true;
+		auto entry = batches.begin();
+		while (entry != batches.end() && entry->first == next_batch_index && entry->second.finished) {
+			CombineBatch(entry->first, entry->second, row_groups_to_write);
+			entry = batches.erase(entry);
+			next_batch_index++;
+		}
+	}
+	for (auto &row_group : row_groups_to_write) {
+		TryWriteRowGroup(row_group.first, *row_group.second);
+	}
+}
+
+void CsvColumnarWriter::CombineBatch(idx_t batch_index, CsvColumnarBatch &batch,
+                                     vector<pair<idx_t, unique_ptr<ColumnDataCollection>>> &row_groups_to_write) {
+	// Row groups are ordered by the batch index of their first block, so the rows left of a block that wrote row
+	// groups start a new row group after them
+	auto row_count = batch.rows ? batch.rows->Count() : 0;
+	if (combined_rows &&
+	    (batch.wrote_row_group || combined_rows->Count() + row_count > CsvColumnarFile::ROW_GROUP_SIZE)) {
+		row_groups_to_write.emplace_back(combined_batch_index, std::move(combined_rows));
+	}
+	if (row_count == 0) {
+		return;
+	}
+	if (!combined_rows) {
+		combined_rows = std::move(batch.rows);
+		combined_batch_index = batch_index;
+	} else {
+		combined_rows->Combine(*batch.rows);
+	}
+	if (combined_rows->Count() >= CsvColumnarFile::ROW_GROUP_SIZE) {
+		row_groups_to_write.emplace_back(combined_batch_index, std::move(combined_rows));
+	}
+}
+
+void CsvColumnarWriter::TryWriteRowGroup(idx_t batch_index, ColumnDataCollection &row_group_rows) {
+	try {
+		WriteRowGroup(batch_index, row_group_rows);
+	} catch (std::exception &) {
+		// The sidecar only speeds up later scans (e.g., the disk may be full), so this scan goes on without it
+		failed = true;
+	}
+}
+
+void CsvColumnarWriter::WriteRowGroup(idx_t batch_index, ColumnDataCollection &row_group_rows) {
+	CsvColumnarRowGroup row_group;
+	row_group.row_count = row_group_rows.Count();
+	row_group.num_vectors = 0;
+	vector<unique_ptr<MemoryStream>> streams;
+	for (auto &type : column_types) {
+		streams.push_back(make_uniq<MemoryStream>());
+		row_group.statistics.push_back(CsvZoneMap::CreateEmptyStatistics(type));
+	}
+	// Each column is a series of chunks with a single vector, so columns are read independently of each other
+	for (auto &chunk : row_group_rows.Chunks()) {
+		for (idx_t j = 0; j < column_types.size(); j++) {
+			auto &column = chunk.data[j];
+			auto &validity = FlatVector::Validity(column);
+			for (idx_t row = 0; row < chunk.size(); row++) {
+				CsvZoneMap::UpdateStatistics(row_group.statistics[j], column, row, validity.RowIsValid(row));
+			}
+			DataChunk vector_chunk;
+			vector_chunk.InitializeEmpty({column_types[j]});
+			vector_chunk.data[0].Reference(column);
+			vector_chunk.SetCardinality(chunk.size());
+			BinarySerializer serializer(*streams[j]);
+			serializer.Begin();
+			vector_chunk.Serialize(serializer);
+			serializer.End();
+		}
+		row_group.num_vectors++;
+	}
+	// Columns are compressed outside the lock, so threads filling row groups at the same time compress in parallel
+	vector<pair<unsafe_unique_array<data_t>, idx_t>> compressed_columns;
+	for (auto &stream : streams) {
+		auto bound = duckdb_zstd::ZSTD_compressBound(stream->GetPosition());
+		auto compressed = make_unsafe_uniq_array<data_t>(bound);
+		auto compressed_size = duckdb_zstd::ZSTD_compress(compressed.get(), bound, stream->GetData(),
+		                                                  stream->GetPosition(), CSV_COLUMNAR_COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw IOException("Could not compress a column chunk of %s: %s", path,
+			                  duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		compressed_columns.emplace_back(std::move(compressed), compressed_size);
+	}
+	lock_guard<mutex> guard(write_lock);
+	for (idx_t j = 0; j < compressed_columns.size(); j++) {
+		auto compressed_size = compressed_columns[j].second;
+		handle->Write(compressed_columns[j].first.get(), compressed_size, file_offset);
+		row_group.columns.push_back({file_offset, compressed_size, streams[j]->GetPosition()});
+		file_offset += compressed_size;
+	}
+	row_groups.push_back(std::move(row_group));
+	row_group_batches.push_back(batch_index);
+}
+
+void CsvColumnarWriter::Finish() {
+	if (failed) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	// The scan is complete, so the blocks still kept (e.g., after a gap in the batch indexes) are combined in order
+	vector<pair<idx_t, unique_ptr<ColumnDataCollection>>> row_groups_to_write;
+	for (auto &batch : batches) {
+		CombineBatch(batch.first, batch.second, row_groups_to_write);
+	}
+	batches.clear();
+	if (combined_rows) {
+		row_groups_to_write.emplace_back(combined_batch_index, std::move(combined_rows));
+	}
+	for (auto &row_group : row_groups_to_write) {
+		WriteRowGroup(row_group.first, *row_group.second);
+	}
+	// Row groups are written as their blocks finish, but listed in file order. The row groups of a block are
+	// written by the thread parsing it, so a stable sort keeps them in order.
+	vector<idx_t> order(row_groups.size());
+	for (idx_t i = 0; i < order.size(); i++) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(),
+	                 [&](idx_t a, idx_t b) { return row_group_batches[a] < row_group_batches[b]; });
+	vector<CsvColumnarRowGroup> ordered_row_groups;
+	for (auto i : order) {
+		ordered_row_groups.push_back(std::move(row_groups[i]));
+	}
+	MemoryStream stream;
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	SerializeFooter(serializer, signature, column_types, dialect, ordered_row_groups);
+	serializer.End();
+	uint64_t trailer[CSV_COLUMNAR_TRAILER_SIZE] = {stream.GetPosition(), CSV_COLUMNAR_MAGIC};
+	handle->Write(stream.GetData(), stream.GetPosition(), file_offset);
+	handle->Write(trailer, sizeof(trailer), file_offset + stream.GetPosition());
+	handle->Sync();
+	handle->Close();
+	handle.reset();
+	fs.MoveFile(temp_path, path);
+	finished = true;
+}
+
+} // namespace duckdb
@@ -0,0 +1,240 @@
+#include "csv_compressed_file.hpp"
+
+#include "miniz.hpp"
+#include "zstd.h"
+
+namespace duckdb {
+
+static constexpr uint32_t ZSTD_FRAME_MAGIC = 0xFD2FB528;
+static constexpr uint32_t ZSTD_SKIPPABLE_FRAME_MAGIC = 0x184D2A50; // The low 4 bits are user-defined
+static constexpr idx_t GZIP_HEADER_SIZE = 12;                      // Up to XLEN, which BGZF always has
+static constexpr idx_t GZIP_TRAILER_SIZE = 8;                      // CRC32 and ISIZE
+
+//! Frame headers are little-endian regardless of the platform
+static idx_t LoadLittleEndian(const_data_ptr_t ptr, idx_t nbytes) {
+	idx_t value = 0;
+	for (idx_t i = 0; i < nbytes; i++) {
+		value |= static_cast<idx_t>(ptr[i]) << (8 * i);
+	}
+	return value;
+}
+
+//! Reads the headers through a window over the file, so that walking thousands of small frames does not
+//! issue a read per header field
+class FrameHeaderReader {
+public:
+	explicit FrameHeaderReader(FileHandle &handle_p)
+	: handle(handle_p), file_size(handle.GetFileSize()), window(CsvFrameIndex::HEADER_WINDOW_SIZE),
+	  window_start(0), window_size(0) {
+	}
+
+	//! Returns the `nbytes` bytes at `offset`, or nullptr if they are past the end of the file
+	const_data_ptr_t Read(idx_t offset, idx_t nbytes) {
+		D_ASSERT(nbytes <= window.size());
+		if (offset + nbytes > file_size) {
+			return nullptr;
+		}
+		if (offset < window_start || offset + nbytes > window_start + window_size) {
+			window_start = offset;
+			window_size = MinValue<idx_t>(window.size(), file_size - offset);
+			handle.Read(window.data(), window_size, window_start);
+		}
+		return window.data() + (offset - window_start);
+	}
+
+	FileHandle &handle;
+	const idx_t file_size;
+
+private:
+	vector<data_t> window;
+	idx_t window_start;
+	idx_t window_size;
+};
+
+// A BGZF file is a series of gzip members, each of which has its compressed size in the `BC` extra subfield
+// and its decompressed size in the ISIZE trailer.
+static bool ScanBgzfFrames(FrameHeaderReader &reader, vector<CsvCompressedFrame> &frames) {
+	idx_t offset = 0;
+	while (offset < reader.file_size) {
+		auto header = reader.Read(offset, GZIP_HEADER_SIZE);
+		// ID1, ID2, CM (deflate), and FLG with FEXTRA set
+		if (!header || header[0] != 0x1f || header[1] != 0x8b || header[2] != 8 || !(header[3] & 0x04)) {
+			return false;
+		}
+		auto extra_size = LoadLittleEndian(header + 10, 2);
+		auto extra = reader.Read(offset + GZIP_HEADER_SIZE, extra_size);
+		if (!extra) {
+			return false;
+		}
+		idx_t member_size = 0;
+		for (idx_t pos = 0; pos + 4 <= extra_size;) {
+			auto subfield_size = LoadLittleEndian(extra + pos + 2, 2);
+			if (extra[pos] == 'B' && extra[pos + 1] == 'C' && subfield_size == 2 && pos + 6 <= extra_size) {
+				member_size = LoadLittleEndian(extra + pos + 4, 2) + 1;
+				break;
+			}
+			pos += 4 + subfield_size;
+		}
+		if (member_size < GZIP_HEADER_SIZE + extra_size + GZIP_TRAILER_SIZE) {
+			// Not a BGZF member
+			return false;
+		}
+		auto trailer = reader.Read(offset + member_size - GZIP_TRAILER_SIZE, GZIP_TRAILER_SIZE);
+		if (!trailer) {
+			return false;
+		}
+		frames.push_back({offset, member_size, LoadLittleEndian(trailer + 4, 4)});
+		offset += member_size;
+	}
+	return true;
+}
+
+// A zstd frame header has the decompressed size if the compressor knew it, and the frame is a series of
+// blocks whose sizes are in their 3-byte headers. Skippable frames (e.g., seek tables) carry no data.
+static bool ScanZstdFrames(FrameHeaderReader &reader, vector<CsvCompressedFrame> &frames) {
+	static constexpr idx_t DICT_ID_SIZES[] = {0, 1, 2, 4};
+	idx_t offset = 0;
+	while (offset < reader.file_size) {
+		auto magic_ptr = reader.Read(offset, 4);
+		if (!magic_ptr) {
+			return false;
+		}
+		auto magic = LoadLittleEndian(magic_ptr, 4);
+		if ((magic & 0xFFFFFFF0) == ZSTD_SKIPPABLE_FRAME_MAGIC) {
+			auto size_ptr = reader.Read(offset + 4, 4);
+			if (!size_ptr) {
+				return false;
+			}
+			offset += 8 + LoadLittleEndian(size_ptr, 4);
+			continue;
+		}
+		if (magic != ZSTD_FRAME_MAGIC) {
+			return false;
+		}
+		auto pos = offset + 4;
+		auto descriptor_ptr = reader.Read(pos++, 1);
+		if (!descriptor_ptr) {
+			return false;
+		}
+		auto descriptor = descriptor_ptr[0];
+		auto content_size_flag = descriptor >> 6;
+		auto single_segment = (descriptor >> 5) & 1;
+		auto has_checksum = (descriptor >> 2) & 1;
+		if (!single_segment) {
+			pos++; // Window descriptor
+		}
+		pos += DICT_ID_SIZES[descriptor & 3];
+		idx_t content_size_bytes = content_size_flag == 0 ? single_segment : idx_t(1) << content_size_flag;
+		if (content_size_bytes == 0) {
+			// The decompressed size is unknown, so the frame can only be streamed
+			return false;
+		}
+		auto content_size_ptr = reader.Read(pos, content_size_bytes);
+		if (!content_size_ptr) {
+			return false;
+		}
+		auto content_size = LoadLittleEndian(content_size_ptr, content_size_bytes);
+		if (content_size_bytes == 2) {
+			content_size += 256;
+		}
+		pos += content_size_bytes;
+		while (true) {
+			auto block_header_ptr = reader.Read(pos, 3);
+			if (!block_header_ptr) {
+				return false;
+			}
+			auto block_header = LoadLittleEndian(block_header_ptr, 3);
+			auto last_block = block_header & 1;
+			auto block_type = (block_header >> 1) & 3;
+			if (block_type == 3) {
+				// Reserved
+				return false;
+			}
+			// An RLE block has a single byte repeated for its size
+			pos += 3 + (block_type == 1 ? 1 : block_header >> 3);
+			if (last_block) {
+				break;
+			}
+		}
+		if (has_checksum) {
+			pos += 4;
+		}
+		if (pos > reader.file_size) {
+			return false;
+		}
+		frames.push_back({offset, pos - offset, content_size});
+		offset = pos;
+	}
+	return true;
+}
+
+FileCompressionType CsvFrameIndex::GetCompression(const string &path, FileCompressionType compression) {
+	if (compression != FileCompressionType::AUTO_DETECT) {
+		return compression;
+	}
+	auto lower_path = StringUtil::Lower(path);
+	if (StringUtil::EndsWith(lower_path, ".gz")) {
+		return FileCompressionType::GZIP;
+	}
+	if (StringUtil::EndsWith(lower_path, ".zst")) {
+		return FileCompressionType::ZSTD;
+	}
+	return FileCompressionType::UNCOMPRESSED;
+}
+
+shared_ptr<CsvFrameIndex> CsvFrameIndex::TryBuild(FileHandle &handle, FileCompressionType compression) {
+	if (!handle.CanSeek() || handle.IsPipe()) {
+		return nullptr;
+	}
+	auto result = make_shared_ptr<CsvFrameIndex>();
+	result->compression = compression;
+	FrameHeaderReader reader(handle);
+	bool is_framed;
+	switch (compression) {
+	case FileCompressionType::GZIP:
+		is_framed = ScanBgzfFrames(reader, result->frames);
+		break;
+	case FileCompressionType::ZSTD:
+		is_framed = ScanZstdFrames(reader, result->frames);
+		break;
+	default:
+		return nullptr;
+	}
+	// A single frame cannot be split any further, so it is decompressed as a stream
+	if (!is_framed || result->frames.size() < 2) {
+		return nullptr;
+	}
+	return result;
+}
+
+void CsvFrameIndex::Decompress(FileHandle &handle, idx_t frame_idx, data_ptr_t out) const {
+	auto &frame = frames[frame_idx];
+	if (frame.decompressed_size == 0) {
+		return;
+	}
+	auto compressed = make_unsafe_uniq_array<data_t>(frame.size);
+	handle.Read(compressed.get(), frame.size, frame.offset);
+	if (compression == FileCompressionType::GZIP) {
+		// The member body is a raw deflate stream between the header and the trailer
+		auto header_size = GZIP_HEADER_SIZE + LoadLittleEndian(compressed.get() + 10, 2);
+		auto result = duckdb_miniz::tinfl_decompress_mem_to_mem(
+		    out, frame.decompressed_size, compressed.get() + header_size, frame.size - header_size - GZIP_TRAILER_SIZE,
+		    0);
+		if (result != frame.decompressed_size) {
+			throw IOException("Could not decompress a gzip member at offset %llu of %s", frame.offset,
+			                  handle.GetPath());
+		}
+	} else {
+		auto result = duckdb_zstd::ZSTD_decompress(out, frame.decompressed_size, compressed.get(), frame.size);
+		if (duckdb_zstd::ZSTD_isError(result)) {
+			throw IOException("Could not decompress a zstd frame at offset %llu of %s: %s", frame.offset,
+			                  handle.GetPath(), duckdb_zstd::ZSTD_getErrorName(result));
+		}
+		if (result != frame.decompressed_size) {
+			throw IOException("Could not decompress a zstd frame at offset %llu of %s", frame.offset,
+			                  handle.GetPath());
+		}
+	}
+}
+
+} // namespace duckdb
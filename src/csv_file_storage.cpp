@@ -10,8 +10,9 @@
 
 namespace duckdb {
 
-static string ParseNamedParameter(const string &name, const string &connection_string) {
-    std::regex pattern(R"((\S+?)=(\{.*?\}|\S+))");
+static bool TryParseNamedParameter(const string &name, const string &connection_string, string &result) {
+    // Values can be empty (e.g., `quote=` disables quoting)
+    std::regex pattern(R"((\S+?)=(\{.*?\}|\S*))");
     std::smatch match;
     std::string::const_iterator searchStart(connection_string.cbegin());
 
@@ -21,13 +22,70 @@ static string ParseNamedParameter(const string &name, const string &connection_s
             std::string key = match[1].str();
             std::string value = match[2].str();
             if (key == name) {
-                return value;
+                result = value;
+                return true;
             }
         }
         searchStart = match.suffix().first;
     }
+	return false;
+}
+
+static string ParseNamedParameter(const string &name, const string &connection_string) {
+	string value;
+	if (!TryParseNamedParameter(name, connection_string, value)) {
+		throw BinderException("Could not find parameter %s in connection string", name);
+	}
+	return value;
+}
 
-	throw BinderException("Could not find parameter %s in connection string", name);
+static ScanCsvOptions ParseScanOptions(const string &connection_string) {
+	ScanCsvOptions options;
+	string value;
+	if (TryParseNamedParameter("buffer_size", connection_string, value)) {
+		options.buffer_size = Value(value).GetValue<uint64_t>();
+		if (options.buffer_size < 1024) {
+			throw BinderException("buffer_size must be at least 1024 bytes");
+		}
+		options.adaptive_block_size = false;
+	}
+	if (TryParseNamedParameter("mmap", connection_string, value)) {
+		options.mmap = Value(value).GetValue<bool>();
+	}
+	if (TryParseNamedParameter("read_ahead", connection_string, value)) {
+		options.read_ahead = Value(value).GetValue<uint64_t>();
+	}
+	if (TryParseNamedParameter("line_index", connection_string, value)) {
+		options.line_index = Value(value).GetValue<bool>();
+	}
+	if (TryParseNamedParameter("zone_map", connection_string, value)) {
+		options.zone_map = Value(value).GetValue<bool>();
+	}
+	if (TryParseNamedParameter("columnar", connection_string, value)) {
+		options.columnar = Value(value).GetValue<bool>();
+	}
+	if (TryParseNamedParameter("compression", connection_string, value)) {
+		options.compression = FileCompressionTypeFromString(value);
+	}
+	if (TryParseNamedParameter("cache", connection_string, value)) {
+		options.cache = Value(value).GetValue<bool>();
+	}
+	if (TryParseNamedParameter("columnar_sidecar", connection_string, value)) {
+		options.columnar_sidecar = Value(value).GetValue<bool>();
+	}
+	if (TryParseNamedParameter("delimiter", connection_string, value)) {
+		options.dialect.delimiter = CsvDialect::ParseChar("delimiter", value, false);
+	}
+	if (TryParseNamedParameter("quote", connection_string, value)) {
+		options.dialect.quote = CsvDialect::ParseChar("quote", value, true);
+	}
+	// A quote is escaped by doubling it unless another escape character is given
+	options.dialect.escape = options.dialect.quote;
+	if (TryParseNamedParameter("escape", connection_string, value)) {
+		options.dialect.escape = CsvDialect::ParseChar("escape", value, true);
+	}
+	options.dialect.Verify();
+	return options;
 }
 
 static void ParseSchemaString(ClientContext &context, const string &schema_string,
@@ -70,6 +128,20 @@ static void ParseSchemaFromSchemaString(ClientContext &context, const string &sc
 }
 
 // ATTACH 'file=data/test.csv relname=testrel schema={"a": "varchar", "b": "bigint", "c": "double"}' AS csv (TYPE CSV_SCANNER);
+// `file` can be a glob pattern (e.g., file=logs/*.csv) to scan all the matching files as a single table.
+// Optional parameters:
+//  - buffer_size=N: reads the files in blocks of N bytes (by default, blocks grow from 256KB up to at most 32MB)
+//  - mmap=true: maps the file into memory instead of reading it into buffers
+//  - read_ahead=N: reads up to N blocks ahead (on a background thread only if the file is read in order)
+//  - line_index=true: cuts blocks at the row offsets in the sidecar line index (`<file>.lidx`) built by
+//    csv_build_line_index
+//  - zone_map=true: collects per-block statistics while scanning and skips blocks by them
+//  - columnar=true: tokenizes a vector's worth of rows before converting them a column at a time
+//  - compression=gzip|zstd|none: overrides the compression detected by the file extension (.gz or .zst)
+//  - delimiter=C, quote=C, escape=C: the dialect of the file (`\t` for a tab); quote and escape default to `"`, and
+//    an empty quote (`quote=`) disables quoting
+//  - cache=true: keeps the decoded rows in memory after the first full scan, until the files change
+//  - columnar_sidecar=true: reads the rows from a columnar copy (`<file>.ccol`) written by the first full scan
 static unique_ptr<Catalog> CsvFileAttach(StorageExtensionInfo *storage_info, ClientContext &context,
                                          AttachedDatabase &db, const string &name, AttachInfo &info,
                                          AccessMode access_mode) {
@@ -81,7 +153,8 @@ static unique_ptr<Catalog> CsvFileAttach(StorageExtensionInfo *storage_info, Cli
 	vector<LogicalType> column_types;
 	vector<string> column_names;
 	ParseSchemaString(context, schema, column_types, column_names);
-	return make_uniq<CsvFileCatalog>(db, file, schname, relname, column_types, column_names);
+	auto options = ParseScanOptions(connection_string);
+	return make_uniq<CsvFileCatalog>(db, file, schname, relname, column_types, column_names, options);
 }
 
 CsvFileStorageExtension::CsvFileStorageExtension() {
@@ -90,10 +163,10 @@ CsvFileStorageExtension::CsvFileStorageExtension() {
 
 CsvFileCatalog::CsvFileCatalog(AttachedDatabase &db_p, const string &file_p, const string &schname_p,
                                const string &relname_p, const vector<LogicalType> &column_types_p,
-                               const vector<string> &column_names_p)
+                               const vector<string> &column_names_p, const ScanCsvOptions &options_p)
 	: ReadOnlyCatalog(db_p), schema(schname_p), database_size(0) {
 	CreateSchemaInfo info;
-	entry = make_uniq<CsvFileSchemaEntry>(*this, info, file_p, relname_p, column_types_p, column_names_p);
+	entry = make_uniq<CsvFileSchemaEntry>(*this, info, file_p, relname_p, column_types_p, column_names_p, options_p);
 }
 
 idx_t CsvFileCatalog::GetDataBaseByteSize(ClientContext &context) {
@@ -102,8 +175,10 @@ idx_t CsvFileCatalog::GetDataBaseByteSize(ClientContext &context) {
 	}
 	auto &fs = FileSystem::GetFileSystem(context);
 	auto file = reinterpret_cast<CsvFileSchemaEntry *>(entry.get())->table->file;
-	auto file_handle = fs.OpenFile(file, FileFlags::FILE_FLAGS_READ);
-	database_size = file_handle->GetFileSize();
+	for (auto &path : fs.GlobFiles(file, context, FileGlobOptions::DISALLOW_EMPTY)) {
+		auto file_handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		database_size += file_handle->GetFileSize();
+	}
 	return database_size;
 }
 
@@ -131,40 +206,76 @@ optional_ptr<SchemaCatalogEntry> CsvFileCatalog::GetSchema(CatalogTransaction tr
 
 CsvFileTableEntry::CsvFileTableEntry(Catalog &catalog_p, SchemaCatalogEntry &schema_p, CreateTableInfo &info_p,
                                      const string &file_p, const string &relname_p,
-                                     const vector<LogicalType> &column_types_p, const vector<string> &column_names_p)
+                                     const vector<LogicalType> &column_types_p, const vector<string> &column_names_p,
+                                     const ScanCsvOptions &options_p)
 	: ReadOnlyTableCatalogEntry(catalog_p, schema_p, info_p), file(file_p), relname(relname_p),
-	  column_types(column_types_p), column_names(column_names_p) {
+	  column_types(column_types_p), column_names(column_names_p), options(options_p) {
+}
+
+static CsvFileSignature GetFileSignature(ClientContext &context, const string &path) {
+	// Open the path again: a handle kept open would not see a file replaced by a rename
+	auto file_handle = FileSystem::GetFileSystem(context).OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	return CsvFileSignature::Get(*file_handle);
+}
+
+shared_ptr<ScanCsvBindData> CsvFileTableEntry::GetBindData(ClientContext &context) {
+	// The planner asks for the statistics of every column, so creating the bind data (which globs the files and
+	// loads the line index) for each of them would redo the same work. The bind data serves a whole query.
+	lock_guard<mutex> guard(statistics_lock);
+	auto query = context.transaction.GetActiveQuery();
+	if (statistics_bind_data && statistics_query == query) {
+		return statistics_bind_data;
+	}
+	// Statistics and exact row counts come from the zone map or the line index of the first file, which are worth
+	// keeping while that file is unchanged. Otherwise, globbing the files again is cheaper than checking each of them.
+	if (statistics_bind_data && (options.zone_map || statistics_bind_data->line_index)) {
+		try {
+			if (GetFileSignature(context, statistics_bind_data->files[0]) == statistics_signature) {
+				statistics_query = query;
+				return statistics_bind_data;
+			}
+		} catch (std::exception &) {
+			// The file is gone; create the bind data again, which reports the error if the pattern matches nothing
+		}
+	}
+	statistics_bind_data = ScanCsvBindData::Create(context, {file}, column_names, column_types, options);
+	if (options.zone_map || statistics_bind_data->line_index) {
+		statistics_signature = GetFileSignature(context, statistics_bind_data->files[0]);
+	}
+	statistics_query = query;
+	return statistics_bind_data;
 }
 
 unique_ptr<BaseStatistics> CsvFileTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
-	return nullptr;
+	if (!options.zone_map) {
+		return nullptr;
+	}
+	return GetBindData(context)->GetStatistics(context, column_id);
 }
 
 TableFunction CsvFileTableEntry::GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) {
-	auto &fs = FileSystem::GetFileSystem(context);
-	auto file_handle = fs.OpenFile(file, FileFlags::FILE_FLAGS_READ);
-	auto result = make_uniq<ScanCsvBindData>(column_names, column_types, ScanCsvOptions(), std::move(file_handle));
-	bind_data = std::move(result);
+	bind_data = ScanCsvBindData::Create(context, {file}, column_names, column_types, options);
 	auto function = CsvScanFunction();
 	return function;
 }
 
 TableStorageInfo CsvFileTableEntry::GetStorageInfo(ClientContext &context) {
 	TableStorageInfo info;
-	info.cardinality = 0;
+	info.cardinality = GetBindData(context)->GetCardinality(context)->estimated_cardinality;
 	return info;
 }
 
 CsvFileSchemaEntry::CsvFileSchemaEntry(Catalog &catalog, CreateSchemaInfo &info, const string &file_p,
                                        const string &relname_p, const vector<LogicalType> &column_types_p,
-                                       const vector<string> &column_names_p)
+                                       const vector<string> &column_names_p, const ScanCsvOptions &options_p)
 	: ReadOnlySchemaCatalogEntry(catalog, info) {
 	CreateTableInfo table_info(*this, relname_p);
 	for (idx_t i = 0; i < column_names_p.size(); i++) {
 		ColumnDefinition c(column_names_p[i], column_types_p[i]);
 		table_info.columns.AddColumn(std::move(c));
 	}
-	table = make_uniq<CsvFileTableEntry>(catalog, *this, table_info, file_p, relname_p, column_types_p, column_names_p);
+	table = make_uniq<CsvFileTableEntry>(catalog, *this, table_info, file_p, relname_p, column_types_p, column_names_p,
+	                                     options_p);
 }
 
 void CsvFileSchemaEntry::Scan(ClientContext &context, CatalogType type,
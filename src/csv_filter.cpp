@@ -0,0 +1,251 @@
+#include "csv_filter.hpp"
+
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
+
+namespace duckdb {
+
+template <class T>
+static bool CompareConstant(ExpressionType comparison_type, const T &value, const T &constant) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return Equals::Operation(value, constant);
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return NotEquals::Operation(value, constant);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return LessThan::Operation(value, constant);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return GreaterThan::Operation(value, constant);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return LessThanEquals::Operation(value, constant);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return GreaterThanEquals::Operation(value, constant);
+	default:
+		throw InternalException("Unsupported comparison in a CSV filter: %s", ExpressionTypeToString(comparison_type));
+	}
+}
+
+template <class T>
+static bool EvaluateFilter(const TableFilter &filter, const T &value, bool is_valid) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return is_valid &&
+		       CompareConstant<T>(constant_filter.comparison_type, value, constant_filter.constant.GetValueUnsafe<T>());
+	}
+	case TableFilterType::IS_NULL:
+		return !is_valid;
+	case TableFilterType::IS_NOT_NULL:
+		return is_valid;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (!EvaluateFilter<T>(*child_filter, value, is_valid)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (EvaluateFilter<T>(*child_filter, value, is_valid)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		if (!is_valid) {
+			return false;
+		}
+		for (auto &constant : in_filter.values) {
+			if (Equals::Operation(value, constant.GetValueUnsafe<T>())) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::OPTIONAL_FILTER:
+		// Optional filters are just hints, so we do not need to evaluate them
+		return true;
+	default:
+		// Dynamic filters are replaced by their values (see CsvFilter::Snapshot) before the rows are evaluated
+		throw InternalException("Unsupported filter type in a CSV filter: %s", EnumUtil::ToString(filter.filter_type));
+	}
+}
+
+template <class T>
+static bool EvaluateFilter(const TableFilter &filter, Vector &vector, idx_t row) {
+	auto is_valid = FlatVector::Validity(vector).RowIsValid(row);
+	return EvaluateFilter<T>(filter, FlatVector::GetData<T>(vector)[row], is_valid);
+}
+
+bool CsvFilter::Evaluate(const TableFilter &filter, Vector &vector, idx_t row) {
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return EvaluateFilter<bool>(filter, vector, row);
+	case PhysicalType::INT8:
+		return EvaluateFilter<int8_t>(filter, vector, row);
+	case PhysicalType::INT16:
+		return EvaluateFilter<int16_t>(filter, vector, row);
+	case PhysicalType::INT32:
+		return EvaluateFilter<int32_t>(filter, vector, row);
+	case PhysicalType::INT64:
+		return EvaluateFilter<int64_t>(filter, vector, row);
+	case PhysicalType::INT128:
+		return EvaluateFilter<hugeint_t>(filter, vector, row);
+	case PhysicalType::FLOAT:
+		return EvaluateFilter<float>(filter, vector, row);
+	case PhysicalType::DOUBLE:
+		return EvaluateFilter<double>(filter, vector, row);
+	case PhysicalType::VARCHAR:
+		return EvaluateFilter<string_t>(filter, vector, row);
+	default:
+		throw InternalException("Unsupported type in a CSV filter: %s", vector.GetType().ToString());
+	}
+}
+
+static bool HasDynamicFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::DYNAMIC_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (HasDynamicFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (HasDynamicFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+static unique_ptr<TableFilter> CopyWithDynamicValues(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return make_uniq<OptionalFilter>();
+		}
+		lock_guard<mutex> lock(dynamic_filter.filter_data->lock);
+		if (!dynamic_filter.filter_data->initialized) {
+			// No value yet, so every row passes
+			return make_uniq<OptionalFilter>();
+		}
+		return dynamic_filter.filter_data->filter->Copy();
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto result = make_uniq<ConjunctionAndFilter>();
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			result->child_filters.push_back(CopyWithDynamicValues(*child_filter));
+		}
+		return std::move(result);
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto result = make_uniq<ConjunctionOrFilter>();
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			result->child_filters.push_back(CopyWithDynamicValues(*child_filter));
+		}
+		return std::move(result);
+	}
+	default:
+		return filter.Copy();
+	}
+}
+
+unique_ptr<TableFilter> CsvFilter::Snapshot(const TableFilter &filter) {
+	if (!HasDynamicFilter(filter)) {
+		return nullptr;
+	}
+	return CopyWithDynamicValues(filter);
+}
+
+void CsvReaderFilter::Snapshot() {
+	snapshot = CsvFilter::Snapshot(filter.get());
+}
+
+static bool IsSupportedFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		switch (filter.Cast<ConstantFilter>().comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOTEQUAL:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			return true;
+		default:
+			return false;
+		}
+	case TableFilterType::IS_NULL:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::OPTIONAL_FILTER:
+		return true;
+	case TableFilterType::DYNAMIC_FILTER: {
+		// The value is set during execution (e.g., by a TopN), but the kind of filter is known up front
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return true;
+		}
+		lock_guard<mutex> lock(dynamic_filter.filter_data->lock);
+		return dynamic_filter.filter_data->filter && IsSupportedFilter(*dynamic_filter.filter_data->filter);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (!IsSupportedFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (!IsSupportedFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool CsvFilter::IsSupported(const TableFilter &filter, const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		return IsSupportedFilter(filter);
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,161 @@
+#include "csv_incremental_state.hpp"
+
+#include "duckdb/main/extension_util.hpp"
+
+namespace duckdb {
+
+CsvIncrementalState::CsvIncrementalState(const CsvDialect &dialect_p) : dialect(dialect_p), offset(0), row_count(0) {
+}
+
+shared_ptr<CsvIncrementalState> CsvIncrementalState::Get(ClientContext &context, const string &file_path,
+                                                         const CsvDialect &dialect) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto key = GetKey(file_path);
+	auto state = cache.Get<CsvIncrementalState>(key);
+	if (state && state->dialect == dialect) {
+		return state;
+	}
+	// The row boundaries found with another dialect may not be boundaries with this one
+	state = make_shared_ptr<CsvIncrementalState>(dialect);
+	cache.Put(key, state);
+	return state;
+}
+
+string CsvIncrementalState::ReadTail(FileHandle &handle, idx_t end_offset) {
+	auto tail_size = MinValue<idx_t>(end_offset, TAIL_SIZE);
+	string result(tail_size, '\0');
+	if (tail_size > 0) {
+		handle.Read(&result[0], tail_size, end_offset - tail_size);
+	}
+	return result;
+}
+
+idx_t CsvIncrementalState::GetStartOffset(FileHandle &handle) {
+	lock_guard<mutex> guard(lock);
+	if (offset == 0) {
+		return 0;
+	}
+	// An appended file still has the consumed rows at the same offsets; a truncated or rotated one does not
+	if (handle.GetFileSize() < offset || ReadTail(handle, offset) != tail) {
+		offset = 0;
+		row_count = 0;
+		tail.clear();
+	}
+	return offset;
+}
+
+void CsvIncrementalState::Advance(idx_t start_offset, idx_t end_offset, string tail_p, idx_t num_rows) {
+	lock_guard<mutex> guard(lock);
+	if (start_offset != offset || end_offset <= offset) {
+		return;
+	}
+	tail = std::move(tail_p);
+	offset = end_offset;
+	row_count += num_rows;
+}
+
+idx_t CsvIncrementalState::EstimateNewRows(idx_t file_size) {
+	lock_guard<mutex> guard(lock);
+	if (offset == 0 || row_count == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	if (file_size <= offset) {
+		return 0;
+	}
+	return static_cast<idx_t>(static_cast<double>(file_size - offset) * row_count / offset);
+}
+
+void CsvIncrementalState::GetProgress(idx_t &offset_p, idx_t &row_count_p) {
+	lock_guard<mutex> guard(lock);
+	offset_p = offset;
+	row_count_p = row_count;
+}
+
+void CsvIncrementalCommitState::AddScan(ClientContext &context, shared_ptr<CsvIncrementalState> state,
+                                        FileHandle &handle, idx_t start_offset, idx_t end_offset, idx_t num_rows) {
+	if (end_offset <= start_offset) {
+		return;
+	}
+	PendingScan scan;
+	scan.state = std::move(state);
+	scan.start_offset = start_offset;
+	scan.end_offset = end_offset;
+	// The tail is read now, since the file may be appended to again before the transaction commits
+	scan.tail = CsvIncrementalState::ReadTail(handle, end_offset);
+	scan.num_rows = num_rows;
+	auto commit_state = context.registered_state->GetOrCreate<CsvIncrementalCommitState>("csv_incremental_commit");
+	lock_guard<mutex> guard(commit_state->lock);
+	commit_state->pending_scans.push_back(std::move(scan));
+}
+
+void CsvIncrementalCommitState::TransactionCommit(MetaTransaction &transaction, ClientContext &context) {
+	lock_guard<mutex> guard(lock);
+	for (auto &scan : pending_scans) {
+		scan.state->Advance(scan.start_offset, scan.end_offset, std::move(scan.tail), scan.num_rows);
+	}
+	pending_scans.clear();
+}
+
+void CsvIncrementalCommitState::TransactionRollback(MetaTransaction &transaction, ClientContext &context) {
+	lock_guard<mutex> guard(lock);
+	pending_scans.clear();
+}
+
+struct CsvIncrementalStateBindData : public TableFunctionData {
+public:
+	explicit CsvIncrementalStateBindData(const string &file_path_p) : file_path(file_path_p) {
+	}
+
+	const string file_path;
+};
+
+struct CsvIncrementalStateScanState : public GlobalTableFunctionState {
+public:
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> CsvIncrementalStateBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	D_ASSERT(input.inputs.size() == 1);
+	names.emplace_back("file");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("end_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("row_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+	return make_uniq<CsvIncrementalStateBindData>(StringValue::Get(input.inputs[0]));
+}
+
+static unique_ptr<GlobalTableFunctionState> CsvIncrementalStateInit(ClientContext &context,
+                                                                    TableFunctionInitInput &input) {
+	return make_uniq<CsvIncrementalStateScanState>();
+}
+
+static void CsvIncrementalStateScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<CsvIncrementalStateScanState>();
+	if (state.done) {
+		return;
+	}
+	auto &bind_data = data_p.bind_data->Cast<CsvIncrementalStateBindData>();
+	// A file that has never been scanned incrementally has consumed nothing
+	idx_t offset = 0;
+	idx_t row_count = 0;
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto incremental_state = cache.Get<CsvIncrementalState>(CsvIncrementalState::GetKey(bind_data.file_path));
+	if (incremental_state) {
+		incremental_state->GetProgress(offset, row_count);
+	}
+	output.SetValue(0, 0, Value(bind_data.file_path));
+	output.SetValue(1, 0, Value::BIGINT(NumericCast<int64_t>(offset)));
+	output.SetValue(2, 0, Value::BIGINT(NumericCast<int64_t>(row_count)));
+	output.SetCardinality(1);
+	state.done = true;
+}
+
+void CsvIncrementalStateFunction::RegisterFunction(DatabaseInstance &db) {
+	TableFunction incremental_state("csv_incremental_state", {LogicalType::VARCHAR}, CsvIncrementalStateScan,
+	                                CsvIncrementalStateBind, CsvIncrementalStateInit);
+	ExtensionUtil::RegisterFunction(db, incremental_state);
+}
+
+} // namespace duckdb
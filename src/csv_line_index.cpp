@@ -0,0 +1,223 @@
+#include "csv_line_index.hpp"
+
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/main/extension_util.hpp"
+
+namespace duckdb {
+
+//! An index file is a sequence of uint64 values in the native byte order: the header below followed by
+//! the row offsets. The magic number identifies the format version (and rejects the other byte order).
+static constexpr uint64_t CSV_LINE_INDEX_MAGIC = 0x325844494C565343; // "CSVLIDX2"
+static constexpr idx_t CSV_LINE_INDEX_HEADER_SIZE = 8;
+
+//! The size of the buffer used to scan a file when building its index
+static constexpr idx_t CSV_LINE_INDEX_BUILD_BUFFER_SIZE = 8388608; // 8MB
+
+CsvFileSignature CsvFileSignature::Get(FileHandle &handle) {
+	CsvFileSignature signature;
+	signature.file_size = handle.GetFileSize();
+	signature.last_modified = static_cast<int64_t>(handle.file_system.GetLastModifiedTime(handle));
+	return signature;
+}
+
+unique_ptr<CsvLineIndex> CsvLineIndex::Build(FileHandle &handle, idx_t interval, const CsvDialect &dialect) {
+	D_ASSERT(interval > 0);
+	auto result = make_uniq<CsvLineIndex>();
+	result->signature = CsvFileSignature::Get(handle);
+	result->quote = dialect.quote;
+	result->escape = dialect.escape;
+	result->interval = interval;
+	result->row_count = 0;
+
+	auto file_size = result->signature.file_size;
+	auto buffer = make_unsafe_uniq_array<char>(CSV_LINE_INDEX_BUILD_BUFFER_SIZE);
+	auto buffer_ptr = buffer.get();
+	// A line can span buffers, so whether we are at the start of a line and in quotes is carried over
+	bool at_line_start = true;
+	bool in_quotes = false;
+	for (idx_t location = 0; location < file_size;) {
+		auto nbytes = MinValue<idx_t>(CSV_LINE_INDEX_BUILD_BUFFER_SIZE, file_size - location);
+		handle.Read(buffer_ptr, nbytes, location);
+		idx_t pos = 0;
+		while (pos < nbytes) {
+			if (at_line_start) {
+				auto is_last_byte = pos + 1 == nbytes;
+				if (buffer_ptr[pos] == '\r' && is_last_byte && location + nbytes < file_size) {
+					// Whether the line is a CRLF is only known with the next byte, so read it again with the next buffer
+					break;
+				}
+				// Empty lines (a bare newline or CRLF) are skipped by the scanner, so they are not counted as rows
+				auto is_empty_line = buffer_ptr[pos] == '\n' ||
+				                     (buffer_ptr[pos] == '\r' && (is_last_byte || buffer_ptr[pos + 1] == '\n'));
+				if (!is_empty_line) {
+					if (result->row_count % interval == 0) {
+						result->row_offsets.push_back(location + pos);
+					}
+					result->row_count++;
+				}
+				at_line_start = false;
+			}
+			pos = dialect.FindRowEnd(buffer_ptr, pos, nbytes, in_quotes);
+			if (pos < nbytes) {
+				pos++;
+				at_line_start = true;
+			}
+		}
+		// Past the buffer if its last byte is an escape character, whose escaped byte is skipped
+		location += pos;
+	}
+	return result;
+}
+
+unique_ptr<CsvLineIndex> CsvLineIndex::TryLoad(FileSystem &fs, const string &index_path,
+                                               const CsvFileSignature &signature, const CsvDialect &dialect) {
+	if (!fs.FileExists(index_path)) {
+		return nullptr;
+	}
+	auto handle = fs.OpenFile(index_path, FileFlags::FILE_FLAGS_READ);
+	auto index_size = handle->GetFileSize();
+	uint64_t header[CSV_LINE_INDEX_HEADER_SIZE];
+	if (index_size < sizeof(header)) {
+		return nullptr;
+	}
+	handle->Read(header, sizeof(header), 0);
+	if (header[0] != CSV_LINE_INDEX_MAGIC || header[1] != signature.file_size ||
+	    static_cast<int64_t>(header[2]) != signature.last_modified || header[3] != uint8_t(dialect.quote) ||
+	    header[4] != uint8_t(dialect.escape)) {
+		return nullptr;
+	}
+	auto result = make_uniq<CsvLineIndex>();
+	result->signature = signature;
+	result->quote = dialect.quote;
+	result->escape = dialect.escape;
+	result->interval = header[5];
+	result->row_count = header[6];
+	auto num_offsets = header[7];
+	if (result->interval == 0 || num_offsets != (result->row_count + result->interval - 1) / result->interval ||
+	    index_size != sizeof(header) + num_offsets * sizeof(uint64_t)) {
+		return nullptr;
+	}
+	result->row_offsets.resize(num_offsets);
+	if (num_offsets > 0) {
+		handle->Read(result->row_offsets.data(), num_offsets * sizeof(uint64_t), sizeof(header));
+	}
+	return result;
+}
+
+shared_ptr<CsvLineIndex> CsvLineIndex::TryLoad(FileHandle &handle, const CsvDialect &dialect) {
+	if (!handle.CanSeek() || handle.IsPipe()) {
+		return nullptr;
+	}
+	auto index = TryLoad(handle.file_system, GetIndexPath(handle.GetPath()), CsvFileSignature::Get(handle), dialect);
+	return shared_ptr<CsvLineIndex>(std::move(index));
+}
+
+void CsvLineIndex::Save(FileSystem &fs, const string &index_path) const {
+	vector<uint64_t> contents {CSV_LINE_INDEX_MAGIC,
+	                           signature.file_size,
+	                           static_cast<uint64_t>(signature.last_modified),
+	                           uint8_t(quote),
+	                           uint8_t(escape),
+	                           interval,
+	                           row_count,
+	                           row_offsets.size()};
+	contents.insert(contents.end(), row_offsets.begin(), row_offsets.end());
+
+	// Concurrent scans may build the same index, so each of them writes its own temporary file
+	auto temp_path = index_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+	{
+		auto handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		handle->Write(contents.data(), contents.size() * sizeof(uint64_t), 0);
+		handle->Sync();
+		handle->Close();
+	}
+	fs.MoveFile(temp_path, index_path);
+}
+
+struct CsvBuildLineIndexBindData : public TableFunctionData {
+public:
+	CsvBuildLineIndexBindData(const string &file_path_p, idx_t interval_p, const CsvDialect &dialect_p)
+	: file_path(file_path_p), interval(interval_p), dialect(dialect_p) {
+	}
+
+	const string file_path;
+	const idx_t interval;
+	const CsvDialect dialect;
+};
+
+struct CsvBuildLineIndexState : public GlobalTableFunctionState {
+public:
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> CsvBuildLineIndexBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	D_ASSERT(input.inputs.size() == 1);
+	auto &file_path = StringValue::Get(input.inputs[0]);
+	idx_t interval = CsvLineIndex::DEFAULT_INTERVAL;
+	CsvDialect dialect;
+	bool has_escape = false;
+	for (auto &kv : input.named_parameters) {
+		auto loption = StringUtil::Lower(kv.first);
+		if (loption == "interval") {
+			interval = kv.second.GetValue<uint64_t>();
+			if (interval == 0) {
+				throw BinderException("interval must be at least 1");
+			}
+		} else if (loption == "quote") {
+			dialect.quote = CsvDialect::ParseChar(loption, StringValue::Get(kv.second), true);
+		} else if (loption == "escape") {
+			dialect.escape = CsvDialect::ParseChar(loption, StringValue::Get(kv.second), true);
+			has_escape = true;
+		}
+	}
+	if (!has_escape) {
+		// A quote is escaped by doubling it unless another escape character is given
+		dialect.escape = dialect.quote;
+	}
+	dialect.Verify();
+	names.emplace_back("file");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("row_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("num_offsets");
+	return_types.emplace_back(LogicalType::BIGINT);
+	return make_uniq<CsvBuildLineIndexBindData>(file_path, interval, dialect);
+}
+
+static unique_ptr<GlobalTableFunctionState> CsvBuildLineIndexInit(ClientContext &context,
+                                                                  TableFunctionInitInput &input) {
+	return make_uniq<CsvBuildLineIndexState>();
+}
+
+static void CsvBuildLineIndexFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<CsvBuildLineIndexState>();
+	if (state.done) {
+		return;
+	}
+	auto &bind_data = data_p.bind_data->Cast<CsvBuildLineIndexBindData>();
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto file_handle = fs.OpenFile(bind_data.file_path, FileFlags::FILE_FLAGS_READ);
+	if (!file_handle->CanSeek() || file_handle->IsPipe()) {
+		throw InvalidInputException("Could not build a line index: %s is not seekable", bind_data.file_path);
+	}
+	auto index = CsvLineIndex::Build(*file_handle, bind_data.interval, bind_data.dialect);
+	index->Save(file_handle->file_system, CsvLineIndex::GetIndexPath(file_handle->GetPath()));
+
+	output.SetValue(0, 0, Value(bind_data.file_path));
+	output.SetValue(1, 0, Value::BIGINT(NumericCast<int64_t>(index->row_count)));
+	output.SetValue(2, 0, Value::BIGINT(NumericCast<int64_t>(index->row_offsets.size())));
+	output.SetCardinality(1);
+	state.done = true;
+}
+
+void CsvLineIndexFunction::RegisterFunction(DatabaseInstance &db) {
+	TableFunction build_line_index("csv_build_line_index", {LogicalType::VARCHAR}, CsvBuildLineIndexFunction,
+	                               CsvBuildLineIndexBind, CsvBuildLineIndexInit);
+	build_line_index.named_parameters["interval"] = LogicalType::UBIGINT;
+	build_line_index.named_parameters["quote"] = LogicalType::VARCHAR;
+	build_line_index.named_parameters["escape"] = LogicalType::VARCHAR;
+	ExtensionUtil::RegisterFunction(db, build_line_index);
+}
+
+} // namespace duckdb
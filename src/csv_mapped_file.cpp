@@ -0,0 +1,54 @@
+#include "csv_mapped_file.hpp"
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#define CSV_SCANNER_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+CsvMappedFile::~CsvMappedFile() {
+#ifdef CSV_SCANNER_HAS_MMAP
+	munmap(data, size);
+#endif
+}
+
+shared_ptr<CsvMappedFile> CsvMappedFile::TryMap(FileHandle &handle) {
+#ifdef CSV_SCANNER_HAS_MMAP
+	// Other file systems (e.g., httpfs) and compressed files go through the buffered path
+	if (handle.file_system.GetName() != "LocalFileSystem" || !handle.CanSeek()) {
+		return nullptr;
+	}
+	auto size = handle.GetFileSize();
+	if (size == 0) {
+		return nullptr;
+	}
+	auto fd = open(handle.GetPath().c_str(), O_RDONLY);
+	if (fd < 0) {
+		return nullptr;
+	}
+	auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping stays valid after the descriptor is closed
+	close(fd);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+	madvise(data, size, MADV_SEQUENTIAL);
+	return make_shared_ptr<CsvMappedFile>(static_cast<data_ptr_t>(data), size);
+#else
+	return nullptr;
+#endif
+}
+
+void CsvMappedFile::WillNeed(idx_t offset, idx_t nbytes) const {
+#ifdef CSV_SCANNER_HAS_MMAP
+	// madvise requires a page-aligned address
+	auto page_size = static_cast<idx_t>(sysconf(_SC_PAGESIZE));
+	auto aligned_offset = offset & ~(page_size - 1);
+	madvise(data + aligned_offset, nbytes + offset - aligned_offset, MADV_WILLNEED);
+#endif
+}
+
+} // namespace duckdb
@@ -0,0 +1,64 @@
+#include "csv_quote_tracker.hpp"
+
+namespace duckdb {
+
+CsvQuoteTracker::CsvQuoteTracker(idx_t num_ranges)
+	: transitions(num_ranges), has_transition(num_ranges, false), start_states(num_ranges + 1, CsvQuoteState::OUTSIDE),
+	  num_resolved(0), cancelled(false) {
+}
+
+void CsvQuoteTracker::SetTransitionInternal(idx_t range_idx, CsvQuoteTransition transition) {
+	D_ASSERT(range_idx < transitions.size());
+	transitions[range_idx] = transition;
+	has_transition[range_idx] = true;
+	while (num_resolved < transitions.size() && has_transition[num_resolved]) {
+		start_states[num_resolved + 1] = transitions[num_resolved].Apply(start_states[num_resolved]);
+		num_resolved++;
+	}
+}
+
+void CsvQuoteTracker::CheckCancelled() const {
+	if (cancelled) {
+		throw IOException("Could not resolve the quotes of a CSV block: a preceding block failed");
+	}
+}
+
+void CsvQuoteTracker::SetTransition(idx_t range_idx, CsvQuoteTransition transition) {
+	lock_guard<mutex> guard(lock);
+	SetTransitionInternal(range_idx, transition);
+}
+
+bool CsvQuoteTracker::Resolve(idx_t range_idx, CsvQuoteTransition transition, CsvQuoteState &start_state) {
+	lock_guard<mutex> guard(lock);
+	CheckCancelled();
+	SetTransitionInternal(range_idx, transition);
+	if (range_idx > num_resolved) {
+		parked_ranges.insert(range_idx);
+		return false;
+	}
+	start_state = start_states[range_idx];
+	return true;
+}
+
+bool CsvQuoteTracker::TakeResolved(idx_t &range_idx, CsvQuoteState &start_state) {
+	lock_guard<mutex> guard(lock);
+	if (parked_ranges.empty()) {
+		return false;
+	}
+	CheckCancelled();
+	auto first = parked_ranges.begin();
+	if (*first > num_resolved) {
+		return false;
+	}
+	range_idx = *first;
+	start_state = start_states[range_idx];
+	parked_ranges.erase(first);
+	return true;
+}
+
+void CsvQuoteTracker::Cancel() {
+	lock_guard<mutex> guard(lock);
+	cancelled = true;
+}
+
+} // namespace duckdb
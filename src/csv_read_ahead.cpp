@@ -0,0 +1,117 @@
+#include "csv_read_ahead.hpp"
+#include "csv_scanner.hpp"
+
+#if defined(__linux__)
+#define CSV_SCANNER_HAS_FADVISE
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+CsvReadAhead::CsvReadAhead(std::function<unique_ptr<CsvBlock>()> read_block_p, idx_t max_blocks_p)
+	: read_block(std::move(read_block_p)), max_blocks(max_blocks_p), blocks_in_flight(0), finished(false),
+	  stopped(false) {
+	D_ASSERT(max_blocks > 0);
+#ifndef DUCKDB_NO_THREADS
+	reader_thread = std::thread(&CsvReadAhead::Run, this);
+#endif
+}
+
+CsvReadAhead::~CsvReadAhead() {
+	{
+		lock_guard<mutex> guard(lock);
+		stopped = true;
+	}
+	slot_free.notify_all();
+	if (reader_thread.joinable()) {
+		reader_thread.join();
+	}
+}
+
+bool CsvReadAhead::IsSupported() {
+#ifndef DUCKDB_NO_THREADS
+	return true;
+#else
+	return false;
+#endif
+}
+
+void CsvReadAhead::Run() {
+	while (true) {
+		{
+			unique_lock<mutex> guard(lock);
+			slot_free.wait(guard, [&] { return stopped || blocks_in_flight < max_blocks; });
+			if (stopped) {
+				return;
+			}
+			blocks_in_flight++;
+		}
+		unique_ptr<CsvBlock> block;
+		try {
+			block = read_block();
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(lock);
+			error = ErrorData(ex);
+			finished = true;
+			block_ready.notify_all();
+			return;
+		}
+		lock_guard<mutex> guard(lock);
+		if (!block) {
+			blocks_in_flight--;
+			finished = true;
+			block_ready.notify_all();
+			return;
+		}
+		blocks.push_back(std::move(block));
+		block_ready.notify_one();
+	}
+}
+
+unique_ptr<CsvBlock> CsvReadAhead::Next() {
+	unique_lock<mutex> guard(lock);
+	block_ready.wait(guard, [&] { return !blocks.empty() || finished; });
+	if (error.HasError()) {
+		error.Throw();
+	}
+	if (blocks.empty()) {
+		return nullptr;
+	}
+	auto block = std::move(blocks.front());
+	blocks.pop_front();
+	blocks_in_flight--;
+	slot_free.notify_one();
+	return block;
+}
+
+CsvFilePrefetcher::~CsvFilePrefetcher() {
+#ifdef CSV_SCANNER_HAS_FADVISE
+	close(fd);
+#endif
+}
+
+unique_ptr<CsvFilePrefetcher> CsvFilePrefetcher::TryCreate(FileHandle &handle) {
+#ifdef CSV_SCANNER_HAS_FADVISE
+	// Other file systems (e.g., httpfs) have no page cache to fill
+	if (handle.file_system.GetName() != "LocalFileSystem" || !handle.CanSeek()) {
+		return nullptr;
+	}
+	// The hints go through a descriptor of our own, since FileHandle does not expose its descriptor
+	auto fd = open(handle.GetPath().c_str(), O_RDONLY);
+	if (fd < 0) {
+		return nullptr;
+	}
+	return unique_ptr<CsvFilePrefetcher>(new CsvFilePrefetcher(fd));
+#else
+	return nullptr;
+#endif
+}
+
+void CsvFilePrefetcher::WillNeed(idx_t offset, idx_t nbytes) const {
+#ifdef CSV_SCANNER_HAS_FADVISE
+	posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(nbytes), POSIX_FADV_WILLNEED);
+#endif
+}
+
+} // namespace duckdb
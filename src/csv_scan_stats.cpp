@@ -0,0 +1,139 @@
+#include "csv_scan_stats.hpp"
+
+#include "duckdb/main/extension_util.hpp"
+
+namespace duckdb {
+
+const char *CsvScanStats::GetName(CsvScanCounter counter) {
+	switch (counter) {
+	case CsvScanCounter::BYTES_READ:
+		return "bytes_read";
+	case CsvScanCounter::BLOCKS:
+		return "blocks";
+	case CsvScanCounter::ROWS:
+		return "rows";
+	case CsvScanCounter::SKIPPED_BLOCKS:
+		return "skipped_blocks";
+	case CsvScanCounter::READ_TIME:
+		return "read_ms";
+	case CsvScanCounter::LOCK_WAIT_TIME:
+		return "lock_wait_ms";
+	case CsvScanCounter::TOKENIZE_TIME:
+		return "tokenize_ms";
+	case CsvScanCounter::CONVERT_TIME:
+		return "convert_ms";
+	case CsvScanCounter::PARSE_TIME:
+		return "parse_ms";
+	default:
+		throw InternalException("Unknown CsvScanCounter");
+	}
+}
+
+void CsvScanStats::ToString(const vector<reference<const CsvScanStats>> &thread_stats,
+                            InsertionOrderPreservingMap<string> &result) {
+	result["Threads"] = std::to_string(thread_stats.size());
+	for (idx_t i = 0; i < CSV_SCAN_COUNTER_COUNT; i++) {
+		auto counter = static_cast<CsvScanCounter>(i);
+		idx_t total = 0;
+		for (auto &stats : thread_stats) {
+			total += stats.get().Get(counter);
+		}
+		// Times are summed over the threads, so they can exceed the wall-clock time of the scan
+		result[GetName(counter)] = IsTime(counter) ? StringUtil::Format("%.3f", total / 1e6) : std::to_string(total);
+	}
+}
+
+shared_ptr<CsvScanStatsHistory> CsvScanStatsHistory::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return cache.GetOrCreate<CsvScanStatsHistory>(ObjectType());
+}
+
+void CsvScanStatsHistory::Add(const string &file, idx_t num_files,
+                              const vector<reference<const CsvScanStats>> &thread_stats) {
+	CsvScanRecord record;
+	record.file = file;
+	record.num_files = num_files;
+	for (auto &stats : thread_stats) {
+		array<idx_t, CSV_SCAN_COUNTER_COUNT> thread_counters;
+		for (idx_t i = 0; i < CSV_SCAN_COUNTER_COUNT; i++) {
+			thread_counters[i] = stats.get().Get(static_cast<CsvScanCounter>(i));
+		}
+		record.thread_counters.push_back(thread_counters);
+	}
+	lock_guard<mutex> guard(lock);
+	record.scan_id = next_scan_id++;
+	if (records.size() >= MAX_SCANS) {
+		records.erase(records.begin());
+	}
+	records.push_back(std::move(record));
+}
+
+vector<CsvScanRecord> CsvScanStatsHistory::GetRecords() {
+	lock_guard<mutex> guard(lock);
+	return records;
+}
+
+struct CsvScanStatsScanState : public GlobalTableFunctionState {
+public:
+	vector<CsvScanRecord> records;
+	idx_t record_idx = 0;
+	idx_t thread_idx = 0;
+};
+
+static unique_ptr<FunctionData> CsvScanStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("scan_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("file");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("num_files");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("thread");
+	return_types.emplace_back(LogicalType::BIGINT);
+	for (idx_t i = 0; i < CSV_SCAN_COUNTER_COUNT; i++) {
+		auto counter = static_cast<CsvScanCounter>(i);
+		names.emplace_back(CsvScanStats::GetName(counter));
+		return_types.emplace_back(CsvScanStats::IsTime(counter) ? LogicalType::DOUBLE : LogicalType::BIGINT);
+	}
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> CsvScanStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto state = make_uniq<CsvScanStatsScanState>();
+	state->records = CsvScanStatsHistory::Get(context)->GetRecords();
+	return std::move(state);
+}
+
+static void CsvScanStatsScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<CsvScanStatsScanState>();
+	idx_t count = 0;
+	while (count < STANDARD_VECTOR_SIZE && state.record_idx < state.records.size()) {
+		auto &record = state.records[state.record_idx];
+		if (state.thread_idx >= record.thread_counters.size()) {
+			state.record_idx++;
+			state.thread_idx = 0;
+			continue;
+		}
+		auto &counters = record.thread_counters[state.thread_idx];
+		output.SetValue(0, count, Value::BIGINT(NumericCast<int64_t>(record.scan_id)));
+		output.SetValue(1, count, Value(record.file));
+		output.SetValue(2, count, Value::BIGINT(NumericCast<int64_t>(record.num_files)));
+		output.SetValue(3, count, Value::BIGINT(NumericCast<int64_t>(state.thread_idx)));
+		for (idx_t i = 0; i < CSV_SCAN_COUNTER_COUNT; i++) {
+			auto value = CsvScanStats::IsTime(static_cast<CsvScanCounter>(i))
+			                 ? Value::DOUBLE(counters[i] / 1e6)
+			                 : Value::BIGINT(NumericCast<int64_t>(counters[i]));
+			output.SetValue(4 + i, count, value);
+		}
+		state.thread_idx++;
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void CsvScanStatsFunction::RegisterFunction(DatabaseInstance &db) {
+	TableFunction scanner_stats("csv_scanner_stats", {}, CsvScanStatsScan, CsvScanStatsBind, CsvScanStatsInit);
+	ExtensionUtil::RegisterFunction(db, scanner_stats);
+}
+
+} // namespace duckdb
@@ -1,5 +1,8 @@
 #define DUCKDB_BUILD_LOADABLE_EXTENSION
 #include "csv_file_storage.hpp"
+#include "csv_incremental_state.hpp"
+#include "csv_line_index.hpp"
+#include "csv_scan_stats.hpp"
 #include "csv_scanner.hpp"
 
 using namespace duckdb;
@@ -21,6 +24,9 @@ DUCKDB_EXTENSION_API void csv_scanner_init(DatabaseInstance &db) {
 	// Instead of csv_scanner_storage_init, we inject this extension here into DuckDB
 	csv_scanner_storage_init(db.config);
 	CsvScannerFunction::RegisterFunction(db);
+	CsvLineIndexFunction::RegisterFunction(db);
+	CsvIncrementalStateFunction::RegisterFunction(db);
+	CsvScanStatsFunction::RegisterFunction(db);
 }
 
 }
@@ -0,0 +1,190 @@
+#include "csv_structural_index.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CSV_SCANNER_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace duckdb {
+
+//! The kernels also build the bitmask of quotes into `quote_out` unless it is null
+typedef void (*build_structural_index_t)(const char *data, idx_t nwords, char delimiter, char quote, uint64_t *out,
+                                         uint64_t *quote_out);
+
+static void BuildScalar(const char *data, idx_t nwords, char delimiter, char quote, uint64_t *out,
+                        uint64_t *quote_out) {
+	for (idx_t w = 0; w < nwords; w++) {
+		auto word_ptr = data + w * 64;
+		uint64_t word = 0;
+		uint64_t quote_word = 0;
+		for (idx_t i = 0; i < 64; i++) {
+			auto c = word_ptr[i];
+			word |= uint64_t((c == delimiter) | (c == '\n')) << i;
+			quote_word |= uint64_t(c == quote) << i;
+		}
+		out[w] = word;
+		if (quote_out) {
+			quote_out[w] = quote_word;
+		}
+	}
+}
+
+#ifdef CSV_SCANNER_X86_SIMD
+// SSE2 is always available on x86-64
+static void BuildSSE2(const char *data, idx_t nwords, char delimiter, char quote, uint64_t *out,
+                      uint64_t *quote_out) {
+	auto delimiters = _mm_set1_epi8(delimiter);
+	auto newlines = _mm_set1_epi8('\n');
+	auto quotes = _mm_set1_epi8(quote);
+	for (idx_t w = 0; w < nwords; w++) {
+		auto word_ptr = data + w * 64;
+		uint64_t word = 0;
+		uint64_t quote_word = 0;
+		for (idx_t i = 0; i < 4; i++) {
+			auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(word_ptr + i * 16));
+			auto m = _mm_or_si128(_mm_cmpeq_epi8(v, delimiters), _mm_cmpeq_epi8(v, newlines));
+			word |= uint64_t(uint32_t(_mm_movemask_epi8(m))) << (i * 16);
+			quote_word |= uint64_t(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, quotes)))) << (i * 16);
+		}
+		out[w] = word;
+		if (quote_out) {
+			quote_out[w] = quote_word;
+		}
+	}
+}
+
+__attribute__((target("avx2"))) static void BuildAVX2(const char *data, idx_t nwords, char delimiter, char quote,
+                                                      uint64_t *out, uint64_t *quote_out) {
+	auto delimiters = _mm256_set1_epi8(delimiter);
+	auto newlines = _mm256_set1_epi8('\n');
+	auto quotes = _mm256_set1_epi8(quote);
+	for (idx_t w = 0; w < nwords; w++) {
+		auto word_ptr = data + w * 64;
+		auto lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(word_ptr));
+		auto hi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(word_ptr + 32));
+		auto lo_mask = _mm256_or_si256(_mm256_cmpeq_epi8(lo, delimiters), _mm256_cmpeq_epi8(lo, newlines));
+		auto hi_mask = _mm256_or_si256(_mm256_cmpeq_epi8(hi, delimiters), _mm256_cmpeq_epi8(hi, newlines));
+		out[w] = uint64_t(uint32_t(_mm256_movemask_epi8(lo_mask))) |
+		         (uint64_t(uint32_t(_mm256_movemask_epi8(hi_mask))) << 32);
+		if (quote_out) {
+			quote_out[w] = uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, quotes)))) |
+			               (uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, quotes)))) << 32);
+		}
+	}
+}
+#endif
+
+struct StructuralIndexKernel {
+	build_structural_index_t build;
+	const char *name;
+};
+
+static StructuralIndexKernel SelectKernel() {
+#ifdef CSV_SCANNER_X86_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return {BuildAVX2, "avx2"};
+	}
+	return {BuildSSE2, "sse2"};
+#else
+	return {BuildScalar, "scalar"};
+#endif
+}
+
+static const StructuralIndexKernel &GetKernel() {
+	static const StructuralIndexKernel kernel = SelectKernel();
+	return kernel;
+}
+
+const char *CsvStructuralIndex::GetKernelName() {
+	return GetKernel().name;
+}
+
+//! The i-th bit of the result is the parity of the bits at or below i, i.e., whether the i-th byte is
+//! after an odd number of quotes in the word
+static inline uint64_t PrefixXor(uint64_t word) {
+	word ^= word << 1;
+	word ^= word << 2;
+	word ^= word << 4;
+	word ^= word << 8;
+	word ^= word << 16;
+	word ^= word << 32;
+	return word;
+}
+
+void CsvStructuralIndex::Build(const char *data, idx_t len_p, const CsvDialect &dialect, bool simd) {
+	len = len_p;
+	has_quotes = false;
+	auto nwords = (len + 63) / 64;
+	bitmask.resize(nwords);
+	if (nwords == 0) {
+		return;
+	}
+	uint64_t *quote_out = nullptr;
+	if (dialect.HasQuotes()) {
+		quote_bitmask.resize(nwords);
+		quote_out = quote_bitmask.data();
+	}
+	// The SIMD kernels only process full 64-byte words, so the last partial word is copied into a scratch
+	// buffer padded with a byte that never matches a structural character or a quote.
+	auto full_words = len / 64;
+	auto build = simd ? GetKernel().build : BuildScalar;
+	build(data, full_words, dialect.delimiter, dialect.quote, bitmask.data(), quote_out);
+	auto remaining = len - full_words * 64;
+	if (remaining > 0) {
+		char padding = ' ';
+		while (padding == dialect.delimiter || padding == dialect.quote) {
+			padding++;
+		}
+		char tail[64];
+		memset(tail, padding, sizeof(tail));
+		memcpy(tail, data + full_words * 64, remaining);
+		BuildScalar(tail, 1, dialect.delimiter, dialect.quote, bitmask.data() + full_words,
+		            quote_out ? quote_out + full_words : nullptr);
+	}
+	if (quote_out) {
+		for (idx_t w = 0; w < nwords && !has_quotes; w++) {
+			has_quotes = quote_out[w] != 0;
+		}
+		if (has_quotes) {
+			MaskQuotedParts(data, dialect);
+		}
+	}
+}
+
+void CsvStructuralIndex::MaskQuotedParts(const char *data, const CsvDialect &dialect) {
+	if (dialect.HasQuoteParity()) {
+		// A byte is in a quoted part if an odd number of quotes precede it. A doubled quote toggles
+		// the state twice, so it needs no special care.
+		uint64_t carry = 0;
+		for (idx_t w = 0; w < bitmask.size(); w++) {
+			auto quote_word = quote_bitmask[w];
+			if (quote_word == 0 && carry == 0) {
+				continue;
+			}
+			auto in_quotes = PrefixXor(quote_word) ^ carry;
+			bitmask[w] &= ~in_quotes;
+			// All ones if the word ends in a quoted part
+			carry = uint64_t(0) - (in_quotes >> 63);
+		}
+		return;
+	}
+	// A distinct escape character can hide a quote, so the state is tracked byte by byte
+	bool in_quotes = false;
+	for (idx_t pos = 0; pos < len; pos++) {
+		auto c = data[pos];
+		if (in_quotes) {
+			bitmask[pos / 64] &= ~(uint64_t(1) << (pos % 64));
+			if (c == dialect.escape && pos + 1 < len) {
+				pos++;
+				bitmask[pos / 64] &= ~(uint64_t(1) << (pos % 64));
+			} else if (c == dialect.quote) {
+				in_quotes = false;
+			}
+		} else if (c == dialect.quote) {
+			in_quotes = true;
+		}
+	}
+}
+
+} // namespace duckdb
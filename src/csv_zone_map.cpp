@@ -0,0 +1,166 @@
+#include "csv_zone_map.hpp"
+
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+
+namespace duckdb {
+
+CsvZoneMap::CsvZoneMap(const CsvFileSignature &signature_p, const vector<LogicalType> &column_types_p,
+                       idx_t block_size_p, const CsvDialect &dialect_p)
+	: signature(signature_p), column_types(column_types_p), block_size(block_size_p), dialect(dialect_p),
+	  num_collected_blocks(0), num_collected_rows(0) {
+	D_ASSERT(block_size > 0);
+	blocks.resize((signature.file_size + block_size - 1) / block_size);
+	quote_transitions.resize(blocks.size());
+	has_quote_transition.resize(blocks.size(), false);
+}
+
+shared_ptr<CsvZoneMap> CsvZoneMap::Get(ClientContext &context, FileHandle &handle,
+                                       const vector<LogicalType> &column_types, idx_t block_size,
+                                       const CsvDialect &dialect) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto key = ObjectType() + ":" + handle.GetPath();
+	auto signature = CsvFileSignature::Get(handle);
+	auto zone_map = cache.Get<CsvZoneMap>(key);
+	if (zone_map && zone_map->signature == signature && zone_map->column_types == column_types &&
+	    zone_map->block_size == block_size && zone_map->dialect == dialect) {
+		return zone_map;
+	}
+	zone_map = make_shared_ptr<CsvZoneMap>(signature, column_types, block_size, dialect);
+	cache.Put(key, zone_map);
+	return zone_map;
+}
+
+bool CsvZoneMap::HasBlock(idx_t block_index) {
+	lock_guard<mutex> guard(lock);
+	return block_index < blocks.size() && blocks[block_index];
+}
+
+void CsvZoneMap::SetBlock(idx_t block_index, vector<BaseStatistics> statistics, vector<idx_t> null_counts,
+                          idx_t row_count) {
+	D_ASSERT(statistics.size() == column_types.size() && null_counts.size() == column_types.size());
+	lock_guard<mutex> guard(lock);
+	if (block_index >= blocks.size() || blocks[block_index]) {
+		return;
+	}
+	auto block = make_uniq<Block>();
+	block->statistics = std::move(statistics);
+	block->null_counts = std::move(null_counts);
+	blocks[block_index] = std::move(block);
+	num_collected_blocks++;
+	num_collected_rows += row_count;
+}
+
+void CsvZoneMap::SetEmptyBlock(idx_t block_index) {
+	vector<BaseStatistics> statistics;
+	for (auto &type : column_types) {
+		statistics.push_back(CreateEmptyStatistics(type));
+	}
+	SetBlock(block_index, std::move(statistics), vector<idx_t>(column_types.size(), 0), 0);
+}
+
+void CsvZoneMap::SetQuoteTransition(idx_t block_index, CsvQuoteTransition quote_transition) {
+	lock_guard<mutex> guard(lock);
+	if (block_index < quote_transitions.size()) {
+		quote_transitions[block_index] = quote_transition;
+		has_quote_transition[block_index] = true;
+	}
+}
+
+bool CsvZoneMap::CanSkip(idx_t block_index, const vector<CsvReaderFilter> &filters,
+                         CsvQuoteTransition &quote_transition) {
+	lock_guard<mutex> guard(lock);
+	if (block_index >= blocks.size() || !blocks[block_index] || !has_quote_transition[block_index]) {
+		return false;
+	}
+	quote_transition = quote_transitions[block_index];
+	auto &statistics = blocks[block_index]->statistics;
+	for (auto &filter : filters) {
+		auto result = filter.filter.get().CheckStatistics(statistics[filter.column_idx]);
+		if (result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+			return true;
+		}
+	}
+	return false;
+}
+
+unique_ptr<BaseStatistics> CsvZoneMap::GetStatistics(idx_t column_idx) {
+	lock_guard<mutex> guard(lock);
+	if (column_idx >= column_types.size() || num_collected_blocks < blocks.size()) {
+		return nullptr;
+	}
+	auto result = CreateEmptyStatistics(column_types[column_idx]);
+	for (auto &block : blocks) {
+		result.Merge(block->statistics[column_idx]);
+	}
+	return result.ToUnique();
+}
+
+bool CsvZoneMap::TryGetRowCount(idx_t &row_count) {
+	lock_guard<mutex> guard(lock);
+	if (num_collected_blocks < blocks.size()) {
+		return false;
+	}
+	row_count = num_collected_rows;
+	return true;
+}
+
+bool CsvZoneMap::TryGetNullCount(idx_t column_idx, idx_t &null_count) {
+	lock_guard<mutex> guard(lock);
+	if (column_idx >= column_types.size() || num_collected_blocks < blocks.size()) {
+		return false;
+	}
+	null_count = 0;
+	for (auto &block : blocks) {
+		null_count += block->null_counts[column_idx];
+	}
+	return true;
+}
+
+BaseStatistics CsvZoneMap::CreateEmptyStatistics(const LogicalType &type) {
+	auto statistics = BaseStatistics::CreateEmpty(type);
+	// No value has been seen yet; UpdateStatistics widens these as values come
+	statistics.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+	statistics.Set(StatsInfo::CANNOT_HAVE_VALID_VALUES);
+	return statistics;
+}
+
+void CsvZoneMap::UpdateStatistics(BaseStatistics &statistics, Vector &vector, idx_t row, bool is_valid) {
+	if (!is_valid) {
+		statistics.Set(StatsInfo::CAN_HAVE_NULL_VALUES);
+		return;
+	}
+	statistics.Set(StatsInfo::CAN_HAVE_VALID_VALUES);
+	// DATE, TIMESTAMP, and DECIMAL values are kept in their physical types
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		NumericStats::Update<bool>(statistics, FlatVector::GetData<bool>(vector)[row]);
+		break;
+	case PhysicalType::INT16:
+		NumericStats::Update<int16_t>(statistics, FlatVector::GetData<int16_t>(vector)[row]);
+		break;
+	case PhysicalType::INT32:
+		NumericStats::Update<int32_t>(statistics, FlatVector::GetData<int32_t>(vector)[row]);
+		break;
+	case PhysicalType::INT64:
+		NumericStats::Update<int64_t>(statistics, FlatVector::GetData<int64_t>(vector)[row]);
+		break;
+	case PhysicalType::INT128:
+		NumericStats::Update<hugeint_t>(statistics, FlatVector::GetData<hugeint_t>(vector)[row]);
+		break;
+	case PhysicalType::FLOAT:
+		NumericStats::Update<float>(statistics, FlatVector::GetData<float>(vector)[row]);
+		break;
+	case PhysicalType::DOUBLE:
+		NumericStats::Update<double>(statistics, FlatVector::GetData<double>(vector)[row]);
+		break;
+	case PhysicalType::VARCHAR:
+		StringStats::Update(statistics, FlatVector::GetData<string_t>(vector)[row]);
+		break;
+	default:
+		throw InternalException("Unsupported type for CSV zone maps: %s", vector.GetType().ToString());
+	}
+}
+
+} // namespace duckdb
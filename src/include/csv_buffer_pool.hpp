@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_buffer_pool.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! Recycles the buffers of CSV blocks within a scan, so that we do not allocate, fault in, and free
+//! a large buffer per block. A buffer goes back to the pool when the last block (and so the last
+//! vector) referencing it is released.
+class CsvBufferPool {
+public:
+	CsvBufferPool(Allocator &allocator, idx_t max_free_buffers, bool use_huge_pages);
+	~CsvBufferPool();
+
+	//! Returns a buffer of at least `size` bytes; `capacity` is set to the actual buffer size
+	data_ptr_t Allocate(idx_t size, idx_t &capacity);
+
+	//! Returns a buffer to the pool
+	void Release(data_ptr_t buffer, idx_t capacity);
+
+private:
+	Allocator &allocator;
+	mutex lock;
+	//! Free buffers and their capacities
+	vector<pair<data_ptr_t, idx_t>> free_buffers;
+	//! Buffers exceeding this number are freed instead of being kept in the pool
+	const idx_t max_free_buffers;
+	//! Whether to back newly allocated buffers with transparent huge pages
+	const bool use_huge_pages;
+};
+
+} // namespace duckdb
@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_cardinality.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! Estimates the number of rows in a CSV file from the average row width in a few samples spread
+//! across the file. A file smaller than the samples is counted exactly.
+struct CsvCardinalityEstimator {
+public:
+	//! Returns the estimated number of rows, or DConstants::INVALID_INDEX if the file cannot be sampled
+	static idx_t EstimateRows(FileHandle &handle);
+
+	static constexpr idx_t NUM_SAMPLES = 8;
+	static constexpr idx_t SAMPLE_SIZE = 65536; // 64KB
+};
+
+} // namespace duckdb
@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_chunk_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "csv_dialect.hpp"
+#include "csv_line_index.hpp"
+
+namespace duckdb {
+
+//! The decoded rows of the files of a table, kept in the object cache of the database so that later scans
+//! are served from memory instead of parsing the files again. The chunks live in blocks of the buffer manager,
+//! so they count against the memory limit and can be evicted. An entry is stale once any of the files changes.
+class CsvChunkCache : public ObjectCacheEntry {
+public:
+	CsvChunkCache(vector<CsvFileSignature> signatures_p, const vector<LogicalType> &column_types_p,
+	              const CsvDialect &dialect_p, unique_ptr<ColumnDataCollection> collection_p);
+
+	//! Returns the cached rows of the files, or nullptr if there are none or they do not match the versions of
+	//! the files, the column types, or the dialect
+	static shared_ptr<CsvChunkCache> TryGet(ClientContext &context, const vector<string> &files,
+	                                        const vector<LogicalType> &column_types, const CsvDialect &dialect);
+
+	//! Returns the current versions of the files
+	static vector<CsvFileSignature> GetSignatures(ClientContext &context, const vector<string> &files);
+
+	static string GetKey(const vector<string> &files) {
+		return ObjectType() + ":" + StringUtil::Join(files, "\n");
+	}
+
+	static string ObjectType() {
+		return "csv_chunk_cache";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	const vector<CsvFileSignature> signatures;
+	const vector<LogicalType> column_types;
+	const CsvDialect dialect;
+	//! All the columns of all the rows, in the order of the files
+	const unique_ptr<ColumnDataCollection> collection;
+
+	//! The max share of the memory limit that the rows of a table can take
+	static constexpr double MAX_MEMORY_RATIO = 0.5;
+};
+
+//! The rows of the block that a thread is scanning, which the thread appends to without taking the lock of the
+//! builder
+struct CsvChunkCacheBatch {
+	idx_t batch_index = DConstants::INVALID_INDEX;
+	unique_ptr<ColumnDataCollection> collection;
+};
+
+//! Collects the chunks of a scan reading all the rows of the files into a new cache entry. The versions of
+//! the files are taken before the scan, so a file changing during the scan makes the entry stale.
+class CsvChunkCacheBuilder {
+public:
+	CsvChunkCacheBuilder(ClientContext &context, const vector<string> &files_p,
+	                     const vector<LogicalType> &column_types_p, const CsvDialect &dialect_p);
+
+	//! Appends a chunk with all the columns from the block with the batch index to the batch of the thread, handing
+	//! the rows of its previous block over first. Gives up once the rows would exceed their share of the memory
+	//! limit.
+	void Append(CsvChunkCacheBatch &batch, idx_t batch_index, DataChunk &chunk);
+
+	//! Hands the rows of the batch over to the builder once its block is done
+	void FinishBatch(CsvChunkCacheBatch &batch);
+
+	//! Puts the collected rows into the object cache in the order of their batch indexes, i.e., in file order,
+	//! unless the builder has given up
+	void Publish();
+
+private:
+	ObjectCache &cache;
+	const vector<string> files;
+	const vector<CsvFileSignature> signatures;
+	const vector<LogicalType> column_types;
+	const CsvDialect dialect;
+	const idx_t max_size;
+
+	BufferManager &buffer_manager;
+	mutex lock;
+	//! The rows of each finished block by its batch index, since threads finish blocks out of order
+	map<idx_t, unique_ptr<ColumnDataCollection>> batches;
+	//! The size of all the rows collected so far, including the batches still being appended to
+	idx_t size;
+	//! Set under the lock, but read without it before appending
+	atomic<bool> given_up;
+};
+
+} // namespace duckdb
@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_column_converter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! Converts the fields of a column into the values of a flat vector. A converter is resolved once per column
+//! at bind time into a function specialized for the column type, so readers do not branch on the type per value.
+struct CsvColumnConverter {
+public:
+	typedef bool (*convert_function_t)(const CsvColumnConverter &converter, const char *ptr, idx_t len,
+	                                   Vector &out_vec, idx_t row);
+	typedef void (*convert_column_function_t)(const CsvColumnConverter &converter, const char *data_ptr,
+	                                          const idx_t *field_starts, const idx_t *field_lengths,
+	                                          const SelectionVector &sel, idx_t count, Vector &out_vec);
+
+	//! Returns the converter of the type, or throws a BinderException if the type is not supported
+	static CsvColumnConverter Get(const LogicalType &type);
+
+	static bool IsSupported(const LogicalType &type);
+
+	//! Converts a field into the row-th value of the vector. Returns false if the field is empty or malformed.
+	inline bool Convert(const char *ptr, idx_t len, Vector &out_vec, idx_t row) const {
+		return len > 0 && function(*this, ptr, len, out_vec, row);
+	}
+
+	//! Converts the fields of the rows in the selection into the vector at the same positions, setting the
+	//! validity of each row. The per-value conversion is inlined into the loop, which runs once per column.
+	inline void ConvertColumn(const char *data_ptr, const idx_t *field_starts, const idx_t *field_lengths,
+	                          const SelectionVector &sel, idx_t count, Vector &out_vec) const {
+		column_function(*this, data_ptr, field_starts, field_lengths, sel, count, out_vec);
+	}
+
+	convert_function_t function;
+	convert_column_function_t column_function;
+	//! The width and scale of a DECIMAL column
+	uint8_t width = 0;
+	uint8_t scale = 0;
+};
+
+} // namespace duckdb
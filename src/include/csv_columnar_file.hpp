@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_columnar_file.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "csv_dialect.hpp"
+#include "csv_filter.hpp"
+#include "csv_line_index.hpp"
+
+namespace duckdb {
+
+//! The zstd-compressed vectors of a column in a row group
+struct CsvColumnarColumnChunk {
+	idx_t offset;
+	idx_t size;
+	idx_t decompressed_size;
+};
+
+struct CsvColumnarRowGroup {
+	//! The number of the first row in the sidecar, which follows from the row counts of the row groups before it
+	idx_t first_row;
+	idx_t row_count;
+	//! The number of vectors in each column chunk
+	idx_t num_vectors;
+	vector<CsvColumnarColumnChunk> columns;
+	vector<BaseStatistics> statistics;
+};
+
+//! A typed, columnar copy of the rows of a CSV file (stored in `<file>.ccol`) that the first full scan of the file
+//! writes and later scans read instead of parsing the text. The rows are split into row groups, and each column of
+//! a row group is a compressed run of serialized vectors with statistics, so row groups can be skipped by filters.
+//! The footer records the size and mtime of the file, the column types, and the dialect; any change makes it stale.
+class CsvColumnarFile {
+public:
+	//! Opens the sidecar of the file, or returns nullptr if it is missing, broken, or written for another version
+	//! of the file, other column types, or another dialect
+	static unique_ptr<CsvColumnarFile> TryOpen(FileSystem &fs, const string &file_path,
+	                                           const CsvFileSignature &signature,
+	                                           const vector<LogicalType> &column_types, const CsvDialect &dialect);
+
+	//! Returns true if the statistics of the row group rule out any row passing all the filters
+	bool CanSkip(idx_t row_group_idx, const vector<CsvReaderFilter> &filters) const;
+
+	//! Reads the columns of the row group into a chunk per vector, which has the columns in the order of
+	//! `column_ids`. This can be called from multiple threads.
+	vector<unique_ptr<DataChunk>> ReadRowGroup(idx_t row_group_idx, const vector<column_t> &column_ids);
+
+	static string GetPath(const string &file_path) {
+		return file_path + ".ccol";
+	}
+
+	vector<LogicalType> column_types;
+	vector<CsvColumnarRowGroup> row_groups;
+
+	//! The max number of rows in a row group, which is the row group size of DuckDB tables
+	static constexpr idx_t ROW_GROUP_SIZE = 122880;
+
+private:
+	unique_ptr<FileHandle> handle;
+};
+
+//! Writes the rows of a full scan into the sidecar of a file. Threads append the chunks of their blocks, which are
+//! written a row group at a time into a temporary file that replaces the sidecar once all the rows are in. A row
+//! group has the rows of a single block, and the footer lists the row groups in the order of the batch indexes of
+//! their blocks, so the sidecar has the rows in file order whichever thread finishes first.
+class CsvColumnarWriter {
+public:
+	CsvColumnarWriter(FileSystem &fs, BufferManager &buffer_manager, const string &file_path,
+	                  const CsvFileSignature &signature_p, const vector<LogicalType> &column_types_p,
+	                  const CsvDialect &dialect_p);
+	//! Removes the temporary file unless the sidecar has been finished
+	~CsvColumnarWriter();
+
+	//! Appends a chunk with all the columns from the block with the batch index; a failed write makes the writer
+	//! give up without failing the scan
+	void Append(idx_t batch_index, DataChunk &chunk);
+
+	//! Marks a block whose chunks have all been appended as finished. The rows left of consecutive finished blocks
+	//! are combined into row groups of up to ROW_GROUP_SIZE rows.
+	void FinishBatch(idx_t batch_index);
+
+	//! Writes the last row group and the footer, and moves the sidecar into place
+	void Finish();
+
+private:
+	//! The rows of a block that do not fill a row group of their own
+	struct CsvColumnarBatch {
+		unique_ptr<ColumnDataCollection> rows;
+		//! Whether full row groups of the block have been written, which the rows left must follow in the file
+		bool wrote_row_group = false;
+		bool finished = false;
+	};
+
+	//! Adds the rows left of the next block in file order to the row group being combined, moving the row groups
+	//! that are full into `row_groups_to_write`; requires the lock
+	void CombineBatch(idx_t batch_index, CsvColumnarBatch &batch,
+	                  vector<pair<idx_t, unique_ptr<ColumnDataCollection>>> &row_groups_to_write);
+	//! Compresses the columns of the rows and appends them to the file
+	void WriteRowGroup(idx_t batch_index, ColumnDataCollection &row_group_rows);
+	//! Writes the rows of a block, giving up on the sidecar if the write fails
+	void TryWriteRowGroup(idx_t batch_index, ColumnDataCollection &row_group_rows);
+
+	FileSystem &fs;
+	const string path;
+	const string temp_path;
+	const CsvFileSignature signature;
+	const vector<LogicalType> column_types;
+	const CsvDialect dialect;
+	BufferManager &buffer_manager;
+
+	//! Guards `batches`, the rows of the row group being filled for each block, and the row group being combined
+	mutex lock;
+	map<idx_t, CsvColumnarBatch> batches;
+	//! The batch index of the next block in file order whose rows are combined once it is finished
+	idx_t next_batch_index;
+	//! The rows of consecutive finished blocks, starting at the block with `combined_batch_index`
+	unique_ptr<ColumnDataCollection> combined_rows;
+	idx_t combined_batch_index;
+
+	//! Guards the file and the row groups written into it
+	mutex write_lock;
+	unique_ptr<FileHandle> handle;
+	idx_t file_offset;
+	vector<CsvColumnarRowGroup> row_groups;
+	//! The batch index of the block of each row group, in the order they are written
+	vector<idx_t> row_group_batches;
+
+	atomic<bool> failed;
+	bool finished;
+};
+
+} // namespace duckdb
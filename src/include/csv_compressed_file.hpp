@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_compressed_file.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/file_compression_type.hpp"
+
+namespace duckdb {
+
+//! A frame of a compressed file that can be decompressed on its own
+struct CsvCompressedFrame {
+	//! The byte range of the frame in the compressed file
+	idx_t offset;
+	idx_t size;
+	idx_t decompressed_size;
+};
+
+//! The frames of a BGZF (blocked gzip) or multi-frame zstd file. Their decompressed sizes are read from the
+//! frame headers and trailers without decompressing anything, so threads can decompress different frames at
+//! the same time. A plain gzip file or a zstd frame without a content size is a single stream.
+struct CsvFrameIndex {
+public:
+	//! Resolves FileCompressionType::AUTO_DETECT by the file extension (.gz or .zst)
+	static FileCompressionType GetCompression(const string &path, FileCompressionType compression);
+
+	//! Returns the frames of the file, or nullptr if it is a single stream or cannot be split into frames
+	static shared_ptr<CsvFrameIndex> TryBuild(FileHandle &handle, FileCompressionType compression);
+
+	//! Decompresses the frame into `out`, which has room for its decompressed size
+	void Decompress(FileHandle &handle, idx_t frame_idx, data_ptr_t out) const;
+
+	FileCompressionType compression;
+	vector<CsvCompressedFrame> frames;
+
+	//! The size of the window used to read the frame headers
+	static constexpr idx_t HEADER_WINDOW_SIZE = 1048576; // 1MB
+};
+
+} // namespace duckdb
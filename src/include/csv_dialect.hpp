@@ -0,0 +1,168 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_dialect.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! The quote state before a byte of a CSV file. ESCAPED is inside quotes right after an escape character, so the
+//! byte is escaped; it only occurs with an escape character distinct from the quote.
+enum class CsvQuoteState : uint8_t { OUTSIDE = 0, QUOTED = 1, ESCAPED = 2 };
+
+//! The quote state at the end of a byte range for each state at its start, packed in two bits per start state
+struct CsvQuoteTransition {
+public:
+	//! The transition of an empty range, which keeps the state
+	CsvQuoteTransition()
+	: CsvQuoteTransition(CsvQuoteState::OUTSIDE, CsvQuoteState::QUOTED, CsvQuoteState::ESCAPED) {
+	}
+
+	CsvQuoteTransition(CsvQuoteState from_outside, CsvQuoteState from_quoted, CsvQuoteState from_escaped)
+	: packed(UnsafeNumericCast<uint8_t>(static_cast<uint8_t>(from_outside) | static_cast<uint8_t>(from_quoted) << 2 |
+	                                    static_cast<uint8_t>(from_escaped) << 4)) {
+	}
+
+	//! Returns the state at the end of the range if it starts in `state`
+	CsvQuoteState Apply(CsvQuoteState state) const {
+		return static_cast<CsvQuoteState>((packed >> (2 * static_cast<uint8_t>(state))) & 3);
+	}
+
+	uint8_t packed;
+};
+
+//! The characters that structure a CSV file. Quoting follows RFC 4180 by default: a quoted field can have
+//! delimiters and newlines in it, and a quote in it is escaped by doubling it.
+struct CsvDialect {
+public:
+	char delimiter = ',';
+	//! '\0' disables quoting
+	char quote = '"';
+	//! The character escaping a quote (or itself) in a quoted field
+	char escape = '"';
+
+	bool HasQuotes() const {
+		return quote != '\0';
+	}
+
+	//! Whether the quote state at a byte follows from the parity of the quotes before it, which is the case
+	//! unless a distinct escape character can hide a quote
+	bool HasQuoteParity() const {
+		return !HasQuotes() || escape == quote;
+	}
+
+	//! Returns the number of the quotes in [0, len)
+	idx_t CountQuotes(const char *data, idx_t len) const {
+		return HasQuotes() ? NumericCast<idx_t>(std::count(data, data + len, quote)) : 0;
+	}
+
+	//! Returns the quote states at the end of [0, len) for each state at its start, so that the state at the start
+	//! of a byte range read in parallel follows from the ranges before it without parsing them
+	CsvQuoteTransition GetQuoteTransition(const char *data, idx_t len) const {
+		if (HasQuoteParity()) {
+			// Each quote flips the state
+			auto flips = CountQuotes(data, len) % 2 == 1;
+			auto from_quoted = flips ? CsvQuoteState::OUTSIDE : CsvQuoteState::QUOTED;
+			return CsvQuoteTransition(flips ? CsvQuoteState::QUOTED : CsvQuoteState::OUTSIDE, from_quoted,
+			                          from_quoted);
+		}
+		// Run the three start states side by side, as FindRowEnd would
+		CsvQuoteState states[] = {CsvQuoteState::OUTSIDE, CsvQuoteState::QUOTED, CsvQuoteState::ESCAPED};
+		for (idx_t pos = 0; pos < len; pos++) {
+			auto c = data[pos];
+			for (auto &state : states) {
+				if (state == CsvQuoteState::ESCAPED) {
+					state = CsvQuoteState::QUOTED;
+				} else if (state == CsvQuoteState::QUOTED && c == escape) {
+					state = CsvQuoteState::ESCAPED;
+				} else if (c == quote) {
+					state = state == CsvQuoteState::QUOTED ? CsvQuoteState::OUTSIDE : CsvQuoteState::QUOTED;
+				}
+			}
+		}
+		return CsvQuoteTransition(states[0], states[1], states[2]);
+	}
+
+	//! Returns the position of the first newline outside quotes in [pos, len), or len if none. `in_quotes` is
+	//! the quote state before `pos`, and it is updated to the state at the returned position. If the data ends
+	//! with an escape character in quotes, len + 1 is returned instead, so the escaped byte is skipped when the
+	//! search goes on in the data after it.
+	idx_t FindRowEnd(const char *data, idx_t pos, idx_t len, bool &in_quotes) const {
+		if (!HasQuotes()) {
+			auto newline = static_cast<const char *>(memchr(data + pos, '\n', len - pos));
+			return newline ? NumericCast<idx_t>(newline - data) : len;
+		}
+		for (; pos < len; pos++) {
+			auto c = data[pos];
+			if (in_quotes) {
+				if (c == escape && escape != quote) {
+					// Skip the escaped character
+					pos++;
+				} else if (c == quote) {
+					in_quotes = false;
+				}
+			} else if (c == quote) {
+				in_quotes = true;
+			} else if (c == '\n') {
+				return pos;
+			}
+		}
+		return pos;
+	}
+
+	//! Returns the size of the complete rows in [0, len), which start outside quotes, i.e., the position
+	//! right after the last newline outside quotes, or 0 if none
+	idx_t FindLastRowEnd(const char *data, idx_t len) const {
+		if (!HasQuotes() || !memchr(data, quote, len)) {
+			// Without quotes, the last newline can be found from the end
+			auto row_end = len;
+			while (row_end > 0 && data[row_end - 1] != '\n') {
+				row_end--;
+			}
+			return row_end;
+		}
+		idx_t last_row_end = 0;
+		bool in_quotes = false;
+		for (idx_t pos = 0; (pos = FindRowEnd(data, pos, len, in_quotes)) < len; pos++) {
+			last_row_end = pos + 1;
+		}
+		return last_row_end;
+	}
+
+	//! Throws a BinderException if a character has two roles
+	void Verify() const {
+		if (HasQuotes() && (delimiter == quote || delimiter == escape)) {
+			throw BinderException("delimiter must differ from quote and escape");
+		}
+		if (!HasQuotes() && escape != '\0') {
+			throw BinderException("escape requires quote");
+		}
+	}
+
+	bool operator==(const CsvDialect &other) const {
+		return delimiter == other.delimiter && quote == other.quote && escape == other.escape;
+	}
+
+	//! Parses the value of a dialect option, which is a single character, `\t` for a tab, or (if allowed) an
+	//! empty string for none
+	static char ParseChar(const string &option, const string &value, bool allow_empty) {
+		if (value.empty() && allow_empty) {
+			return '\0';
+		}
+		if (value == "\\t") {
+			return '\t';
+		}
+		if (value.size() != 1 || value[0] == '\n' || value[0] == '\r') {
+			throw BinderException("%s must be a single character other than a newline", option);
+		}
+		return value[0];
+	}
+};
+
+} // namespace duckdb
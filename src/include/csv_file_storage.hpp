@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "csv_scanner.hpp"
 #include "read_only_storage.hpp"
 
 namespace duckdb {
@@ -21,7 +22,7 @@ class CsvFileCatalog : public ReadOnlyCatalog {
 public:
 	explicit CsvFileCatalog(AttachedDatabase &db_p, const string &file_p, const string &schname_p,
 	                        const string &relname_p, const vector<LogicalType> &column_types_p,
-	                        const vector<string> &column_names_p);
+	                        const vector<string> &column_names_p, const ScanCsvOptions &options_p);
 
 	string GetCatalogType() override {
 		return "csv_scanner";
@@ -46,7 +47,7 @@ class CsvFileTableEntry : public ReadOnlyTableCatalogEntry {
 public:
 	CsvFileTableEntry(Catalog &catalog_p, SchemaCatalogEntry &schema_p, CreateTableInfo &info_p, const string &file_p,
 	                  const string &relname_p, const vector<LogicalType> &column_types_p,
-	                  const vector<string> &column_names_p);
+	                  const vector<string> &column_names_p, const ScanCsvOptions &options_p);
 
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id) override;
 	TableFunction GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) override;
@@ -56,6 +57,18 @@ public:
 	const string relname;
 	const vector<LogicalType> column_types;
 	const vector<string> column_names;
+	const ScanCsvOptions options;
+
+private:
+	//! Returns the bind data that the statistics and the storage info are derived from, reusing the one of the
+	//! previous call in the same query, or in later queries while the first file is unchanged
+	shared_ptr<ScanCsvBindData> GetBindData(ClientContext &context);
+
+	mutex statistics_lock;
+	shared_ptr<ScanCsvBindData> statistics_bind_data;
+	//! The signature of the first file of the bind data when it was created, and the query it was last used by
+	CsvFileSignature statistics_signature;
+	transaction_t statistics_query = MAXIMUM_QUERY_ID;
 };
 
 class CsvFileSchemaEntry : public ReadOnlySchemaCatalogEntry {
@@ -63,7 +76,8 @@ class CsvFileSchemaEntry : public ReadOnlySchemaCatalogEntry {
 
 public:
 	CsvFileSchemaEntry(Catalog &catalog_p, CreateSchemaInfo &info_p, const string &file_p, const string &relname_p,
-	                   const vector<LogicalType> &column_types_p, const vector<string> &column_names_p);
+	                   const vector<LogicalType> &column_types_p, const vector<string> &column_names_p,
+	                   const ScanCsvOptions &options_p);
 
 	void Scan(ClientContext &context, CatalogType type, const std::function<void(CatalogEntry &)> &callback) override;
 	optional_ptr<CatalogEntry> GetEntry(CatalogTransaction transaction, CatalogType type, const string &name_p) override;
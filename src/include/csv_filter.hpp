@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! A pushed-down filter on a column in the CSV file
+struct CsvReaderFilter {
+	CsvReaderFilter(idx_t column_idx_p, idx_t output_idx_p, TableFilter &filter_p)
+	: column_idx(column_idx_p), output_idx(output_idx_p), filter(filter_p) {
+	}
+
+	//! Takes the current values of the dynamic filters in the filter; called once per chunk
+	void Snapshot();
+	//! Returns the filter to evaluate on the rows of the chunk
+	const TableFilter &Get() const {
+		return snapshot ? *snapshot : filter.get();
+	}
+
+	//! The column index in the file
+	idx_t column_idx;
+	//! The column index in the output chunk
+	idx_t output_idx;
+	reference<TableFilter> filter;
+	//! The filter with its dynamic filters replaced by their values at the last Snapshot; null if it has none
+	shared_ptr<TableFilter> snapshot;
+};
+
+//! Evaluates pushed-down table filters on single values, so that the CSV reader can drop a row
+//! right after its filter columns are parsed and before the other columns are materialized.
+struct CsvFilter {
+public:
+	//! Returns true if the row-th value of the flat vector passes the filter
+	static bool Evaluate(const TableFilter &filter, Vector &vector, idx_t row);
+
+	//! Returns a copy of the filter in which each dynamic filter is replaced by its current value, so that the rows
+	//! are evaluated without taking the lock of the dynamic filter; null if the filter has no dynamic filters
+	static unique_ptr<TableFilter> Snapshot(const TableFilter &filter);
+
+	//! Returns true if Evaluate supports the filter on a column of the type. Other filters (e.g., expression filters)
+	//! are evaluated on the output chunks by the expression executor instead.
+	static bool IsSupported(const TableFilter &filter, const LogicalType &type);
+};
+
+} // namespace duckdb
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_incremental_state.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "csv_dialect.hpp"
+
+namespace duckdb {
+
+//! How far the incremental scans of an append-only file have got, kept in the object cache of the database: the
+//! end of the last complete row they consumed and the rows before it. The bytes just before that end are kept to
+//! tell an appended file from a truncated or replaced one, in which case the scans start over from the top.
+class CsvIncrementalState : public ObjectCacheEntry {
+public:
+	explicit CsvIncrementalState(const CsvDialect &dialect_p);
+
+	//! Returns the state of the file, which is empty if the file has not been scanned incrementally with the dialect
+	static shared_ptr<CsvIncrementalState> Get(ClientContext &context, const string &file_path,
+	                                           const CsvDialect &dialect);
+
+	//! Returns the offset to scan the file from, resetting the state if the file no longer starts with the bytes
+	//! consumed so far
+	idx_t GetStartOffset(FileHandle &handle);
+
+	//! Records the rows consumed by a complete scan of [start_offset, end_offset), whose last bytes are `tail`. A scan
+	//! that started from an offset other than the current one (e.g., raced by another scan) is ignored.
+	void Advance(idx_t start_offset, idx_t end_offset, string tail, idx_t num_rows);
+
+	//! Reads the `TAIL_SIZE` bytes (or fewer at the top of the file) just before `end_offset`
+	static string ReadTail(FileHandle &handle, idx_t end_offset);
+
+	//! Estimates the rows in the bytes after the offset by the average row size so far, or returns
+	//! DConstants::INVALID_INDEX if nothing has been consumed yet
+	idx_t EstimateNewRows(idx_t file_size);
+
+	//! Returns the offset and the number of the rows consumed so far
+	void GetProgress(idx_t &offset_p, idx_t &row_count_p);
+
+	static string GetKey(const string &file_path) {
+		return ObjectType() + ":" + file_path;
+	}
+
+	static string ObjectType() {
+		return "csv_incremental_state";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	const CsvDialect dialect;
+
+	//! The max number of bytes before the offset kept to recognize the file
+	static constexpr idx_t TAIL_SIZE = 64;
+
+private:
+	mutex lock;
+	idx_t offset;
+	idx_t row_count;
+	string tail;
+};
+
+//! The rows consumed by the complete incremental scans of a transaction, which are recorded in the states of their
+//! files only once it commits. So, the rows of a scan in a failed statement or a rolled back transaction are returned
+//! again by the next scan. Scans in the same transaction start from the same offset.
+class CsvIncrementalCommitState : public ClientContextState {
+public:
+	//! Records the rows consumed by a complete scan of [start_offset, end_offset) when the transaction commits
+	static void AddScan(ClientContext &context, shared_ptr<CsvIncrementalState> state, FileHandle &handle,
+	                    idx_t start_offset, idx_t end_offset, idx_t num_rows);
+
+	void TransactionCommit(MetaTransaction &transaction, ClientContext &context) override;
+	void TransactionRollback(MetaTransaction &transaction, ClientContext &context) override;
+
+private:
+	struct PendingScan {
+		shared_ptr<CsvIncrementalState> state;
+		idx_t start_offset;
+		idx_t end_offset;
+		string tail;
+		idx_t num_rows;
+	};
+
+	mutex lock;
+	vector<PendingScan> pending_scans;
+};
+
+//! csv_incremental_state(file) returns the offset and the number of the rows consumed by the incremental scans of a
+//! file so far
+struct CsvIncrementalStateFunction {
+	static void RegisterFunction(DatabaseInstance &db);
+};
+
+} // namespace duckdb
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_line_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "csv_dialect.hpp"
+
+namespace duckdb {
+
+//! Identifies a version of a file. Anything derived from the file (e.g., a sidecar index) is
+//! stale once the signature of the file changes.
+struct CsvFileSignature {
+	idx_t file_size;
+	int64_t last_modified;
+
+	static CsvFileSignature Get(FileHandle &handle);
+
+	bool operator==(const CsvFileSignature &other) const {
+		return file_size == other.file_size && last_modified == other.last_modified;
+	}
+};
+
+//! A sidecar index of a CSV file (stored in `<file>.lidx`) that records the byte offset of every
+//! `interval`-th row. Empty lines are not rows, so row numbers match the rows that scan_csv_ex returns.
+//! Newlines in quoted fields do not end rows, so the index is built for the quote and escape characters.
+struct CsvLineIndex {
+public:
+	//! Scans the whole file and builds its index
+	static unique_ptr<CsvLineIndex> Build(FileHandle &handle, idx_t interval, const CsvDialect &dialect);
+
+	//! Loads the index in `index_path`, or returns nullptr if it is missing, broken, or built for another signature
+	//! or other quote and escape characters
+	static unique_ptr<CsvLineIndex> TryLoad(FileSystem &fs, const string &index_path,
+	                                        const CsvFileSignature &signature, const CsvDialect &dialect);
+
+	//! Loads the sidecar index of the file, or returns nullptr if it is missing or stale or the file cannot be indexed
+	static shared_ptr<CsvLineIndex> TryLoad(FileHandle &handle, const CsvDialect &dialect);
+
+	//! Writes the index into `index_path` through a temporary file, so that readers never see a partial one
+	void Save(FileSystem &fs, const string &index_path) const;
+
+	static string GetIndexPath(const string &file_path) {
+		return file_path + ".lidx";
+	}
+
+	//! The default number of rows between two offsets in the index
+	static constexpr idx_t DEFAULT_INTERVAL = 10000;
+
+	CsvFileSignature signature;
+	char quote;
+	char escape;
+	idx_t interval;
+	idx_t row_count;
+	//! `row_offsets[i]` is the byte offset of the `i * interval`-th row
+	vector<idx_t> row_offsets;
+};
+
+//! csv_build_line_index(file, interval := N, quote := '"', escape := '"') builds (or rebuilds) the sidecar index of a CSV file
+struct CsvLineIndexFunction {
+	static void RegisterFunction(DatabaseInstance &db);
+};
+
+} // namespace duckdb
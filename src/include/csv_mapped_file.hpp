@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_mapped_file.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! A read-only memory mapping of a whole local file. The blocks of a memory-mapped scan are views into it,
+//! so they (and the vectors referencing their strings) keep the mapping alive.
+struct CsvMappedFile {
+public:
+	CsvMappedFile(data_ptr_t data_p, idx_t size_p) : data(data_p), size(size_p) {
+	}
+	~CsvMappedFile();
+
+	//! Maps the file if it is a non-empty local file; otherwise, returns nullptr so that callers fall back to reads
+	static shared_ptr<CsvMappedFile> TryMap(FileHandle &handle);
+
+	//! Hints that the range is about to be read
+	void WillNeed(idx_t offset, idx_t nbytes) const;
+
+	const data_ptr_t data;
+	const idx_t size;
+};
+
+} // namespace duckdb
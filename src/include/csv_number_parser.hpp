@@ -0,0 +1,156 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_number_parser.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+
+namespace duckdb {
+
+//! Parsers that convert a (ptr, len) slice of a CSV block into a number in place.
+//! They neither allocate nor throw; a malformed value is reported by returning false.
+struct CsvNumberParser {
+public:
+	static inline bool TryParseBigint(const char *ptr, idx_t len, int64_t &result) {
+		TrimSpaces(ptr, len);
+		idx_t pos = 0;
+		bool negative = false;
+		if (len > 0 && (ptr[0] == '-' || ptr[0] == '+')) {
+			negative = ptr[0] == '-';
+			pos++;
+		}
+		if (pos == len) {
+			return false;
+		}
+		// Leading zeros do not count towards the digits, keeping the last one of an all-zero value
+		while (pos + 1 < len && ptr[pos] == '0') {
+			pos++;
+		}
+		// 19 digits always fit into uint64_t, so no overflow check is needed in the loop
+		if (len - pos > 19) {
+			return false;
+		}
+		uint64_t value = 0;
+		for (; pos < len; pos++) {
+			auto digit = uint8_t(ptr[pos] - '0');
+			if (digit > 9) {
+				return false;
+			}
+			value = value * 10 + digit;
+		}
+		if (negative) {
+			if (value > uint64_t(NumericLimits<int64_t>::Maximum()) + 1) {
+				return false;
+			}
+			result = value == uint64_t(NumericLimits<int64_t>::Maximum()) + 1 ? NumericLimits<int64_t>::Minimum()
+			                                                                   : -int64_t(value);
+			return true;
+		}
+		if (value > uint64_t(NumericLimits<int64_t>::Maximum())) {
+			return false;
+		}
+		result = int64_t(value);
+		return true;
+	}
+
+	//! Values with up to 19 significant digits and small exponents are converted exactly with
+	//! a single multiplication or division (Clinger's fast path); the others go to DuckDB's cast.
+	static inline bool TryParseDouble(const char *ptr, idx_t len, double &result) {
+		TrimSpaces(ptr, len);
+		idx_t pos = 0;
+		bool negative = false;
+		if (len > 0 && (ptr[0] == '-' || ptr[0] == '+')) {
+			negative = ptr[0] == '-';
+			pos++;
+		}
+		uint64_t mantissa = 0;
+		int64_t exponent = 0;
+		idx_t ndigits = 0;
+		for (; pos < len; pos++) {
+			auto digit = uint8_t(ptr[pos] - '0');
+			if (digit > 9) {
+				break;
+			}
+			mantissa = mantissa * 10 + digit;
+			ndigits++;
+		}
+		if (pos < len && ptr[pos] == '.') {
+			pos++;
+			for (; pos < len; pos++) {
+				auto digit = uint8_t(ptr[pos] - '0');
+				if (digit > 9) {
+					break;
+				}
+				mantissa = mantissa * 10 + digit;
+				exponent--;
+				ndigits++;
+			}
+		}
+		if (ndigits == 0 || ndigits > 19) {
+			return TryParseDoubleSlow(ptr, len, result);
+		}
+		if (pos < len && (ptr[pos] == 'e' || ptr[pos] == 'E')) {
+			pos++;
+			bool negative_exponent = false;
+			if (pos < len && (ptr[pos] == '-' || ptr[pos] == '+')) {
+				negative_exponent = ptr[pos] == '-';
+				pos++;
+			}
+			auto exponent_start = pos;
+			int64_t explicit_exponent = 0;
+			for (; pos < len && pos - exponent_start < 4; pos++) {
+				auto digit = uint8_t(ptr[pos] - '0');
+				if (digit > 9) {
+					break;
+				}
+				explicit_exponent = explicit_exponent * 10 + digit;
+			}
+			if (pos == exponent_start) {
+				return false;
+			}
+			exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+		}
+		if (pos != len) {
+			// Special values (e.g., inf and nan), a long exponent or garbage
+			return TryParseDoubleSlow(ptr, len, result);
+		}
+		if (mantissa > (uint64_t(1) << 53) || exponent < -22 || exponent > 22) {
+			return TryParseDoubleSlow(ptr, len, result);
+		}
+		auto value = double(mantissa);
+		value = exponent < 0 ? value / PowerOfTen(-exponent) : value * PowerOfTen(exponent);
+		result = negative ? -value : value;
+		return true;
+	}
+
+private:
+	static inline void TrimSpaces(const char *&ptr, idx_t &len) {
+		while (len > 0 && (ptr[0] == ' ' || ptr[0] == '\t')) {
+			ptr++;
+			len--;
+		}
+		while (len > 0 && (ptr[len - 1] == ' ' || ptr[len - 1] == '\t')) {
+			len--;
+		}
+	}
+
+	static inline bool TryParseDoubleSlow(const char *ptr, idx_t len, double &result) {
+		return TryCast::Operation<string_t, double>(string_t(ptr, UnsafeNumericCast<uint32_t>(len)), result, true);
+	}
+
+	//! Powers of ten that are exactly representable as a double
+	static inline double PowerOfTen(int64_t exponent) {
+		static constexpr double POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+		                                           1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+		                                           1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+		return POWERS_OF_TEN[exponent];
+	}
+};
+
+} // namespace duckdb
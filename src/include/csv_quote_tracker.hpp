@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_quote_tracker.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/set.hpp"
+#include "csv_dialect.hpp"
+
+namespace duckdb {
+
+//! Tracks the quote transitions of the byte ranges of a file split for a parallel scan. The quote state at the start
+//! of a range follows from the transitions of all the ranges before it, so a range's row boundaries are resolved as
+//! soon as the ranges before it have been read, without waiting for them to be parsed. A thread never waits for
+//! them either: a range that cannot be resolved yet is parked, and handed out by TakeResolved once it can.
+class CsvQuoteTracker {
+public:
+	explicit CsvQuoteTracker(idx_t num_ranges);
+
+	//! Publishes the transition of a range that is not parsed (e.g., skipped by its zone map)
+	void SetTransition(idx_t range_idx, CsvQuoteTransition transition);
+
+	//! Publishes the transition of a claimed range. Returns true and the state at its start if the ranges before it
+	//! are known; otherwise, the range is parked, and returned by a later TakeResolved call (of any thread).
+	bool Resolve(idx_t range_idx, CsvQuoteTransition transition, CsvQuoteState &start_state);
+
+	//! Takes a parked range whose start state has become known. Callers take parked ranges before claiming new
+	//! ones, so the thread resolving a parked range takes it unless another thread is faster.
+	bool TakeResolved(idx_t &range_idx, CsvQuoteState &start_state);
+
+	//! Fails the ranges after a range that could not be read, which will never be resolved
+	void Cancel();
+
+private:
+	//! Publishes the transition and resolves the ranges after the resolved ones; requires the lock
+	void SetTransitionInternal(idx_t range_idx, CsvQuoteTransition transition);
+	void CheckCancelled() const;
+
+	mutex lock;
+	vector<CsvQuoteTransition> transitions;
+	vector<bool> has_transition;
+	//! The state at the start of each range in [0, num_resolved]
+	vector<CsvQuoteState> start_states;
+	//! The number of ranges with a transition before the first one without
+	idx_t num_resolved;
+	//! The parked ranges in ascending order
+	set<idx_t> parked_ranges;
+	bool cancelled;
+};
+
+} // namespace duckdb
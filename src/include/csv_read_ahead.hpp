@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_read_ahead.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
+
+namespace duckdb {
+
+struct CsvBlock;
+
+//! Reads blocks ahead on a background thread, so that parsing threads usually get blocks already in memory
+//! and I/O overlaps with parsing. At most `max_blocks` blocks are in flight (being read or waiting in
+//! the queue), which bounds the memory used by read-ahead to `max_blocks` block buffers. Only files read in
+//! order (e.g., streams) use it; the threads reading a file in parallel prefetch with CsvFilePrefetcher instead.
+class CsvReadAhead {
+public:
+	CsvReadAhead(std::function<unique_ptr<CsvBlock>()> read_block_p, idx_t max_blocks_p);
+	~CsvReadAhead();
+
+	//! Returns the next block in the file order, waiting for it to be read if necessary.
+	//! This can be called from multiple threads.
+	unique_ptr<CsvBlock> Next();
+
+	//! Whether read-ahead is available in this build
+	static bool IsSupported();
+
+private:
+	void Run();
+
+	std::function<unique_ptr<CsvBlock>()> read_block;
+	const idx_t max_blocks;
+
+	mutex lock;
+	std::condition_variable block_ready;
+	std::condition_variable slot_free;
+	std::deque<unique_ptr<CsvBlock>> blocks;
+	//! The number of blocks being read or waiting in `blocks`
+	idx_t blocks_in_flight;
+	bool finished;
+	bool stopped;
+	ErrorData error;
+
+	std::thread reader_thread;
+};
+
+//! Asks the OS to read byte ranges of a local file into the page cache in the background, so that the thread
+//! claiming a range later finds it in memory. Hints cost a system call but no memory or thread of our own.
+class CsvFilePrefetcher {
+public:
+	~CsvFilePrefetcher();
+
+	//! Returns a prefetcher for a local file, or nullptr if the file system or the platform has no such hint
+	static unique_ptr<CsvFilePrefetcher> TryCreate(FileHandle &handle);
+
+	//! Hints that [offset, offset + nbytes) is about to be read
+	void WillNeed(idx_t offset, idx_t nbytes) const;
+
+private:
+	explicit CsvFilePrefetcher(int fd_p) : fd(fd_p) {
+	}
+
+	const int fd;
+};
+
+} // namespace duckdb
@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_scan_stats.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/insertion_order_preserving_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+enum class CsvScanCounter : uint8_t {
+	//! Bytes of the blocks handed out to the thread
+	BYTES_READ,
+	//! Blocks of the files or row groups of the sidecar
+	BLOCKS,
+	//! Rows returned after the filters
+	ROWS,
+	//! Blocks of the files or row groups of the sidecar skipped by their statistics without being read
+	SKIPPED_BLOCKS,
+	//! Nanoseconds spent getting blocks: reading, decompressing, finding row boundaries, or waiting for read-ahead
+	READ_TIME,
+	//! Nanoseconds spent waiting for the lock of the global state
+	LOCK_WAIT_TIME,
+	//! Nanoseconds spent indexing blocks and tokenizing rows in the columnar mode
+	TOKENIZE_TIME,
+	//! Nanoseconds spent converting fields in the columnar mode
+	CONVERT_TIME,
+	//! Nanoseconds spent tokenizing and converting rows in the row-at-a-time mode, which interleaves the two
+	PARSE_TIME,
+	COUNT
+};
+
+static constexpr idx_t CSV_SCAN_COUNTER_COUNT = static_cast<idx_t>(CsvScanCounter::COUNT);
+
+//! The counters of a thread of a scan. A single thread updates them, and a counter is updated once per block or
+//! chunk without a read-modify-write instruction, so that they are cheap enough to be always on. Other threads may
+//! read them at any time.
+struct CsvScanStats {
+public:
+	CsvScanStats() {
+		for (auto &counter : counters) {
+			counter.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	inline void Add(CsvScanCounter counter, idx_t value) {
+		auto &target = counters[static_cast<idx_t>(counter)];
+		target.store(target.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	//! Adds the nanoseconds elapsed since `start`, which is a value of Now()
+	inline void AddTime(CsvScanCounter counter, idx_t start) {
+		Add(counter, Now() - start);
+	}
+
+	idx_t Get(CsvScanCounter counter) const {
+		return counters[static_cast<idx_t>(counter)].load(std::memory_order_relaxed);
+	}
+
+	//! Returns the nanoseconds since an arbitrary point in time
+	static inline idx_t Now() {
+		return static_cast<idx_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		                              std::chrono::steady_clock::now().time_since_epoch())
+		                              .count());
+	}
+
+	//! Returns the column name of the counter in csv_scanner_stats()
+	static const char *GetName(CsvScanCounter counter);
+
+	//! Returns whether the counter is a time in nanoseconds
+	static bool IsTime(CsvScanCounter counter) {
+		return counter >= CsvScanCounter::READ_TIME;
+	}
+
+	//! Adds the counters of all the threads to the EXPLAIN ANALYZE output of the scan
+	static void ToString(const vector<reference<const CsvScanStats>> &thread_stats,
+	                     InsertionOrderPreservingMap<string> &result);
+
+private:
+	array<atomic<idx_t>, CSV_SCAN_COUNTER_COUNT> counters;
+};
+
+//! The counters of a finished scan, copied out of its threads
+struct CsvScanRecord {
+	idx_t scan_id;
+	string file;
+	idx_t num_files;
+	//! The counters of each thread
+	vector<array<idx_t, CSV_SCAN_COUNTER_COUNT>> thread_counters;
+};
+
+//! The counters of the recent scans of the database, which csv_scanner_stats() returns
+class CsvScanStatsHistory : public ObjectCacheEntry {
+public:
+	static shared_ptr<CsvScanStatsHistory> Get(ClientContext &context);
+
+	//! Records a finished scan, dropping the oldest one if the history is full
+	void Add(const string &file, idx_t num_files, const vector<reference<const CsvScanStats>> &thread_stats);
+
+	vector<CsvScanRecord> GetRecords();
+
+	static string ObjectType() {
+		return "csv_scan_stats_history";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! The max number of scans kept
+	static constexpr idx_t MAX_SCANS = 64;
+
+private:
+	mutex lock;
+	idx_t next_scan_id = 0;
+	vector<CsvScanRecord> records;
+};
+
+//! csv_scanner_stats() returns the counters of each thread of the recent scans, one row per thread
+struct CsvScanStatsFunction {
+	static void RegisterFunction(DatabaseInstance &db);
+};
+
+} // namespace duckdb
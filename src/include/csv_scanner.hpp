@@ -9,6 +9,18 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "csv_buffer_pool.hpp"
+#include "csv_column_converter.hpp"
+#include "csv_compressed_file.hpp"
+#include "csv_dialect.hpp"
+#include "csv_line_index.hpp"
+#include "csv_mapped_file.hpp"
+#include "csv_quote_tracker.hpp"
+#include "csv_read_ahead.hpp"
+#include "csv_scan_stats.hpp"
+#include "csv_structural_index.hpp"
+#include "csv_zone_map.hpp"
 
 namespace duckdb {
 
@@ -25,16 +37,16 @@ public:
 
 struct CsvFileBuffer {
 public:
-	CsvFileBuffer(Allocator &allocator, uint64_t buffer_size)
-	: allocator(allocator), buffer_size(buffer_size) {
-		internal_buffer = allocator.AllocateData(buffer_size);
+	CsvFileBuffer(shared_ptr<CsvBufferPool> pool_p, uint64_t buffer_size)
+	: pool(std::move(pool_p)), buffer_size(buffer_size) {
+		internal_buffer = pool->Allocate(buffer_size, capacity);
 	}
 
 	~CsvFileBuffer() {
 		if (!internal_buffer) {
 			return;
 		}
-		allocator.FreeData(internal_buffer, buffer_size);
+		pool->Release(internal_buffer, capacity);
 	}
 
 	//! Read into the internal buffer from the specified location.
@@ -44,39 +56,150 @@ public:
 		handle.Read(internal_buffer, nbytes, location);
 	}
 
-	Allocator &allocator;
+	//! Read `nbytes` bytes from the specified location into the internal buffer at `offset`.
+	void Read(FileHandle &handle, uint64_t location, idx_t offset, idx_t nbytes) {
+		D_ASSERT(offset + nbytes <= buffer_size);
+		handle.Read(internal_buffer + offset, nbytes, location);
+	}
+
+	//! Grows the internal buffer while keeping the first `nbytes` bytes in it
+	void Resize(uint64_t new_size, idx_t nbytes) {
+		D_ASSERT(new_size >= nbytes);
+		if (new_size > capacity) {
+			idx_t new_capacity;
+			auto new_buffer = pool->Allocate(new_size, new_capacity);
+			memcpy(new_buffer, internal_buffer, nbytes);
+			pool->Release(internal_buffer, capacity);
+			internal_buffer = new_buffer;
+			capacity = new_capacity;
+		}
+		buffer_size = new_size;
+	}
+
+	//! The pool that the internal buffer comes from and goes back to
+	shared_ptr<CsvBufferPool> pool;
 	data_ptr_t internal_buffer;
 	uint64_t buffer_size;
+	//! The actual size of the internal buffer, which can be larger than `buffer_size` if recycled
+	idx_t capacity;
 };
 
 struct CsvBlock {
 public:
 	CsvBlock(unique_ptr<CsvFileBuffer> data, idx_t actual_size_p)
-	: actual_size(actual_size_p), data(std::move(data)) {
+	: start(0), actual_size(actual_size_p), data(std::move(data)) {
+	};
+
+	//! A block whose rows start at the `start_p` byte of the buffer
+	CsvBlock(unique_ptr<CsvFileBuffer> data, idx_t start_p, idx_t actual_size_p)
+	: start(start_p), actual_size(actual_size_p), data(std::move(data)) {
+	};
+
+	//! A block that is a view into a memory-mapped file
+	CsvBlock(shared_ptr<CsvMappedFile> mapping_p, idx_t start_p, idx_t actual_size_p)
+	: start(start_p), actual_size(actual_size_p), mapping(std::move(mapping_p)) {
 	};
 
 	inline data_ptr_t GetData() {
-		return data->internal_buffer;
+		return (data ? data->internal_buffer : mapping->data) + start;
 	}
 
 	const idx_t GetSize() const {
 		return actual_size;
 	}
 
+	//! The number of the first row in this block, which is only known for blocks cut by a line index
+	idx_t GetFirstRow() const {
+		return first_row;
+	}
+
+	void SetFirstRow(idx_t first_row_p) {
+		first_row = first_row_p;
+	}
+
+	//! The zone map of the file and the index of this block in it, which are only set in the parallel read modes
+	const shared_ptr<CsvZoneMap> &GetZoneMap() const {
+		return zone_map;
+	}
+
+	idx_t GetBlockIndex() const {
+		return block_index;
+	}
+
+	void SetZoneMap(shared_ptr<CsvZoneMap> zone_map_p, idx_t block_index_p) {
+		zone_map = std::move(zone_map_p);
+		block_index = block_index_p;
+	}
+
+	//! The position of this block in the order of the files and of the blocks in them, which is the batch index of
+	//! its rows
+	idx_t GetBatchIndex() const {
+		return batch_index;
+	}
+
+	void SetBatchIndex(idx_t batch_index_p) {
+		batch_index = batch_index_p;
+	}
+
 private:
+	const idx_t start;
 	const idx_t actual_size;
 	unique_ptr<CsvFileBuffer> data;
+	shared_ptr<CsvMappedFile> mapping;
+	idx_t first_row = DConstants::INVALID_INDEX;
+	idx_t batch_index = 0;
+	shared_ptr<CsvZoneMap> zone_map;
+	idx_t block_index = DConstants::INVALID_INDEX;
+};
+
+//! Keeps a CSV block alive while vectors reference the strings in it
+class CsvBlockVectorBuffer : public VectorBuffer {
+public:
+	explicit CsvBlockVectorBuffer(shared_ptr<CsvBlock> block_p)
+	: VectorBuffer(VectorBufferType::OPAQUE_BUFFER), block(std::move(block_p)) {
+	}
+
+private:
+	shared_ptr<CsvBlock> block;
 };
 
 struct CsvBlockIterator {
 public:
-	CsvBlockIterator(Allocator &allocator, shared_ptr<FileHandle> file_handle_p, idx_t buffer_size);
+	//! Blocks start at `first_block_size` bytes and double up to `buffer_size` bytes
+	CsvBlockIterator(shared_ptr<CsvBufferPool> buffer_pool_p, shared_ptr<FileHandle> file_handle_p,
+	                 idx_t buffer_size, idx_t first_block_size, const CsvDialect &dialect, bool parallel_read,
+	                 bool use_mmap, idx_t read_ahead_blocks, shared_ptr<CsvLineIndex> line_index,
+	                 shared_ptr<CsvFrameIndex> frame_index, idx_t row_offset, idx_t row_limit,
+	                 shared_ptr<CsvZoneMap> zone_map, vector<CsvReaderFilter> zone_map_filters,
+	                 idx_t first_batch_index = 0, idx_t start_offset = 0, bool complete_rows_only = false);
+
+	//! Returns the number of batch indexes taken by the blocks of the file, including the skipped ones. It is final
+	//! once Next() returns null.
+	idx_t GetBatchCount() const {
+		if (line_index) {
+			return indexed_block_offsets.empty() ? 0 : indexed_block_offsets.size() - 1;
+		}
+		if (frame_index) {
+			return frame_groups.size() - 1;
+		}
+		if (!range_offsets.empty()) {
+			return range_offsets.size() - 1;
+		}
+		return num_sequential_blocks;
+	}
+
+	//! Returns the number of the blocks skipped by their zone map statistics since the last call
+	idx_t TakeSkippedBlockCount() {
+		return num_skipped_blocks.exchange(0);
+	}
 
+	//! Returns the next block. In the parallel read modes or with read-ahead this can be called from
+	//! multiple threads without any lock; otherwise, callers need to serialize the calls.
 	unique_ptr<CsvBlock> Next();
 
 	//! Returns Current Progress of this CSV Read
 	const double GetProgress() const {
-		return 100.0 * ((double)current_file_pos / file_handle->GetFileSize());
+		return 100.0 * ((double)MinValue<idx_t>(current_file_pos, file_size) / file_size);
 	}
 
 	const idx_t GetBufferSize() const {
@@ -84,60 +207,411 @@ public:
 	}
 
 	const idx_t GetFileSize() const {
-		return file_handle->GetFileSize();
+		return file_size;
+	}
+
+	const bool IsParallel() const {
+		return parallel_read || mapping || read_ahead || line_index || frame_index;
+	}
+
+	//! The offset right after the last block read sequentially, which is the end of a row
+	const idx_t GetReadOffset() const {
+		return current_file_pos;
 	}
 
-	//! TODO: Should benchmarks other values
+	//! Returns the offsets of the byte ranges of a file: the first range has `first_block_size` bytes, and each
+	//! range after it doubles up to `block_size` bytes. The last offset is the file size.
+	static vector<idx_t> CutRanges(idx_t file_size, idx_t first_block_size, idx_t block_size);
+
+	//! Returns the size that the blocks of a file grow to: small enough for every thread to get a few blocks, so
+	//! that small files spread across the threads, but at least MIN_BLOCK_SIZE and at most `max_block_size`
+	static idx_t GetTargetBlockSize(idx_t file_size, idx_t num_threads, idx_t max_block_size);
+
+	//! The max block size by default; csv_scanner_benchmark --buffer-sizes measures others
 	static constexpr idx_t CSV_BUFFER_SIZE = 32000000; // 32MB
 
+	//! The size of the first block of a file, which is small so that the first rows (e.g., of a LIMIT) come back fast
+	static constexpr idx_t FIRST_BLOCK_SIZE = 262144; // 256KB
+
+	//! The smallest block size that blocks grow to, below which the per-block costs (e.g., the lookahead) show up
+	static constexpr idx_t MIN_BLOCK_SIZE = 1048576; // 1MB
+
+	//! The number of blocks that each thread gets at least if the file is large enough, which balances the load
+	static constexpr idx_t BLOCKS_PER_THREAD = 4;
+
+	//! Bytes read past the end of a byte range to find the end of its last row
+	static constexpr idx_t CSV_LOOKAHEAD_SIZE = 65536; // 64KB
+
+	//! Blocks read ahead by default for a stream (e.g., a plain gzip file), so that one thread decompresses
+	//! while the others parse
+	static constexpr idx_t STREAM_READ_AHEAD_BLOCKS = 4;
+
 private:
-	Allocator &allocator;
+	//! Reads the next block in the current read mode
+	unique_ptr<CsvBlock> ReadNext();
+	//! Returns the size of the next block read sequentially and doubles the size of the one after it
+	idx_t NextBlockSize() {
+		auto block_size = next_block_size;
+		next_block_size = MinValue<idx_t>(next_block_size * 2, buffer_size);
+		return block_size;
+	}
+	//! Reads the next block, carrying over its trailing partial row to the next block
+	unique_ptr<CsvBlock> NextSequential();
+	//! A claimed byte range or frame group whose bytes have been read, and whose row boundaries wait for the quote
+	//! state at its start
+	struct PendingRange {
+		//! The bytes read for the range; null for a mapped range, whose bytes are in the mapping
+		unique_ptr<CsvFileBuffer> buffer;
+		//! The file offset of the bytes read
+		idx_t read_start = 0;
+		//! The range is [range_start, range_end) of the bytes, of which `read_bytes` bytes have been read
+		idx_t range_start = 0;
+		idx_t range_end = 0;
+		idx_t read_bytes = 0;
+		//! The frame after the bytes of a frame group
+		idx_t next_frame = 0;
+		CsvQuoteTransition quote_transition;
+	};
+
+	//! Hints the blocks claimed within `prefetch_blocks` after `claimed_idx` to the OS (parallel read modes only)
+	void PrefetchAfter(idx_t claimed_idx);
+	//! Takes a byte range or frame group parked by a thread (maybe this one) once its start state is known
+	bool TakeResolvedRange(idx_t &range_idx, CsvQuoteState &start_state);
+	//! Claims the next byte range and resolves its row boundaries by itself
+	unique_ptr<CsvBlock> NextRange();
+	//! Returns the block of the rows starting in a byte range read by NextRange, or null if none
+	unique_ptr<CsvBlock> FinishRange(idx_t block_index, CsvQuoteState start_state);
+	//! Same as NextRange, but returns a view into the memory-mapped file instead of reading it
+	unique_ptr<CsvBlock> NextMappedRange();
+	unique_ptr<CsvBlock> FinishMappedRange(idx_t block_index, CsvQuoteState start_state);
+	//! Reads the next block from a stream that cannot seek, carrying over its trailing partial row to the next block
+	unique_ptr<CsvBlock> NextStream();
+	//! Claims the next group of compressed frames, decompresses it, and resolves its row boundaries like NextRange
+	unique_ptr<CsvBlock> NextFrameGroup();
+	unique_ptr<CsvBlock> FinishFrameGroup(idx_t group_idx, CsvQuoteState start_state);
+	//! Claims the next block cut by the line index, which needs neither a rewind nor a newline search
+	unique_ptr<CsvBlock> NextIndexedBlock();
+	//! Cuts the blocks covering the rows in [row_offset, row_offset + row_limit) at the offsets in the line index
+	void CutIndexedBlocks(idx_t row_offset, idx_t row_limit);
+	//! Groups consecutive frames into blocks of about `buffer_size` decompressed bytes
+	void CutFrameGroups();
+	//! Publishes the quote transition of the pending range, whose bytes are `data`. Returns true and the quote state
+	//! at its start if the ranges before it are known; otherwise the range is parked for TakeResolvedRange.
+	bool ResolveQuoteState(idx_t range_idx, unique_ptr<PendingRange> pending, const char *data,
+	                       CsvQuoteState &start_state);
+	//! Fails the ranges after a range that failed to be read
+	void CancelQuoteTracker();
+	//! Returns the position of the first row starting in the range [range_start, range_end) of `data`, or
+	//! range_end if none
+	idx_t FindRowStart(const char *data, idx_t range_start, idx_t range_end, CsvQuoteState start_state) const;
+	//! Whether the byte just before `pos` ends a row; a newline is not a quote, so the quote state at `pos` is
+	//! also the state at the newline
+	static inline bool IsRowEnd(const char *data, idx_t pos, bool in_quotes) {
+		return data[pos - 1] == '\n' && !in_quotes;
+	}
+
+	//! Buffers are recycled between blocks through this pool
+	shared_ptr<CsvBufferPool> buffer_pool;
 	shared_ptr<FileHandle> file_handle;
-	idx_t current_file_pos;
+	const idx_t file_size;
+	atomic<idx_t> current_file_pos;
+	//! The size that blocks grow to
 	idx_t buffer_size;
+	const idx_t first_block_size;
+	//! The size of the next block read sequentially or from a stream
+	idx_t next_block_size;
+	const CsvDialect dialect;
+	const bool parallel_read;
+	//! Set if the file is memory-mapped
+	shared_ptr<CsvMappedFile> mapping;
+	//! Set if blocks are cut at the row offsets in the line index of the file
+	shared_ptr<CsvLineIndex> line_index;
+	//! The i-th indexed block covers [indexed_block_offsets[i], indexed_block_offsets[i + 1]) and
+	//! starts with the row numbered indexed_block_rows[i]
+	vector<idx_t> indexed_block_offsets;
+	vector<idx_t> indexed_block_rows;
+	atomic<idx_t> next_indexed_block;
+	//! Set if the file is compressed in frames that are decompressed in parallel; the i-th frame group covers
+	//! the frames in [frame_groups[i], frame_groups[i + 1])
+	shared_ptr<CsvFrameIndex> frame_index;
+	vector<idx_t> frame_groups;
+	atomic<idx_t> next_frame_group;
+	//! The i-th byte range read in parallel covers [range_offsets[i], range_offsets[i + 1])
+	vector<idx_t> range_offsets;
+	atomic<idx_t> next_range;
+	//! Blocks are numbered from `first_batch_index` in file order: by their byte range, indexed block, or frame
+	//! group in the parallel read modes, and in the order they are read otherwise
+	const idx_t first_batch_index;
+	idx_t num_sequential_blocks;
+	//! Set if only the rows numbered in [row_offset, row_end) are read and there is no line index to seek to them.
+	//! The blocks read sequentially or from a stream are then numbered by counting their rows, and only the blocks
+	//! with rows in the range are handed out.
+	const bool counts_rows;
+	const idx_t row_offset;
+	const idx_t row_end;
+	idx_t next_row;
+	//! Set if the byte ranges or frame groups read in parallel can start in quoted fields
+	unique_ptr<CsvQuoteTracker> quote_tracker;
+	//! The byte ranges or frame groups between their read and their row boundaries, by index
+	vector<unique_ptr<PendingRange>> pending_ranges;
+	//! Set if the file handle cannot seek (e.g., a decompressing stream or a pipe)
+	const bool is_stream;
+	//! The partial row at the end of the previous block read sequentially or from a stream
+	vector<char> carry_over;
+	bool stream_finished;
+	//! Set if the partial row at the end of the file is left out, since it may still be being appended
+	const bool complete_rows_only;
+	bool tail_finished;
+	//! Set if blocks excluded by the pushed-down filters are skipped by their statistics
+	shared_ptr<CsvZoneMap> zone_map;
+	vector<CsvReaderFilter> zone_map_filters;
+	atomic<idx_t> num_skipped_blocks {0};
+	//! The number of blocks hinted ahead of the claimed ones if a file read in parallel is read ahead, and the number
+	//! of blocks hinted so far. Mapped files are hinted through the mapping, and other files through the prefetcher.
+	idx_t prefetch_blocks = 0;
+	unique_ptr<CsvFilePrefetcher> prefetcher;
+	atomic<idx_t> prefetched_until {0};
+	//! Set if a stream or a file read in order is read ahead on a background thread; declared last so that the
+	//! thread stops first
+	unique_ptr<CsvReadAhead> read_ahead;
 };
 
 struct CsvReader {
 public:
 	explicit CsvReader(idx_t idx, const vector<string> &column_names_p, const vector<LogicalType> &column_types_p,
-	                   unique_ptr<CsvBlock> block_p);
+	                   const vector<CsvColumnConverter> &converters_p, const CsvDialect &dialect_p,
+	                   const vector<column_t> &column_ids,
+	                   optional_ptr<TableFilterSet> filters, idx_t row_offset, idx_t row_limit, bool columnar_p,
+	                   bool simd_p, CsvScanStats &stats_p, unique_ptr<CsvBlock> block_p);
 
 	//! Flushes the result to the chunk
-	void Flush(DataChunk &chunk);
+	void Flush(DataChunk &chunk) {
+		for (auto &filter : filters) {
+			filter.Snapshot();
+		}
+		// Quoted fields are unquoted one by one, so only blocks without quotes are parsed in two phases. Statistics
+		// need every value of every row, so blocks collecting them are parsed row by row.
+		if (columnar && !structural_index.HasQuotes() && !collect_statistics) {
+			FlushColumns(chunk);
+		} else {
+			auto start = CsvScanStats::Now();
+			FlushRows(chunk);
+			stats.AddTime(CsvScanCounter::PARSE_TIME, start);
+		}
+	}
 
 	void UpdateBlock(unique_ptr<CsvBlock> block_p) {
-		block = std::move(block_p);
+		block = shared_ptr<CsvBlock>(std::move(block_p));
+		block_vector_buffer = make_buffer<CsvBlockVectorBuffer>(block);
 		current_buffer_pos = 0;
+		current_row = block->GetFirstRow();
+		BuildStructuralIndex();
+		StartStatistics();
 	}
 
 	const idx_t GetReaderIndex() const {
 		return reader_idx;
 	}
 
+	//! Returns the batch index of the current block
+	idx_t GetBatchIndex() const {
+		return block->GetBatchIndex();
+	}
+
+	//! Returns the number of the rows tokenized since the last call, before any filter
+	idx_t TakeParsedRowCount() {
+		auto result = num_parsed_rows;
+		num_parsed_rows = 0;
+		return result;
+	}
+
 private:
+	//! Tokenizes and converts the rows one by one
+	void FlushRows(DataChunk &chunk);
+
+	//! Tokenizes a vector's worth of rows into the field matrix first, and then converts a column at a time
+	void FlushColumns(DataChunk &chunk);
+
+	//! Finds the first `num_columns` fields in the row at the current position and moves to the next row.
+	//! Returns the number of the fields found, which is less than `num_columns` for a short row.
+	idx_t TokenizeRow(const char *data_ptr, idx_t data_size, idx_t num_columns);
+
+	//! Converts a field tokenized by TokenizeRow into the row-th value of the vector
+	void ConvertColumn(const char *data_ptr, idx_t column_idx, idx_t num_fields, Vector &out_vec, idx_t row);
+
+	//! Converts a field, which may be quoted, into the row-th value of the vector. Returns false if it is empty or
+	//! malformed.
+	bool ConvertField(const CsvColumnConverter &converter, const char *field_ptr, idx_t len, Vector &out_vec,
+	                  idx_t row);
+
+	//! Skips an empty line (a bare newline or CRLF) at the current position, which is not a row
+	inline bool SkipEmptyLine(const char *data_ptr, idx_t data_size) {
+		auto pos = current_buffer_pos + (data_ptr[current_buffer_pos] == '\r');
+		if (pos < data_size && data_ptr[pos] != '\n') {
+			return false;
+		}
+		current_buffer_pos = pos + 1;
+		return true;
+	}
+
+	//! Starts collecting the statistics of the block if its zone map does not have them yet
+	void StartStatistics();
+
+	//! Converts every column of a row tokenized by TokenizeRow and adds the values into the statistics of the block.
+	//! Output columns are converted into the row-th value of their vectors, so the caller does not convert them again.
+	void CollectRowStatistics(const char *data_ptr, idx_t num_fields, DataChunk &chunk, idx_t row);
+
+	//! Stores the statistics of the block in its zone map once all its rows have been flushed
+	void FinishStatistics();
+
+	void BuildStructuralIndex() {
+		auto start = CsvScanStats::Now();
+		structural_index.Build(char_ptr_cast(block->GetData()), block->GetSize(), dialect, simd);
+		stats.AddTime(CsvScanCounter::TOKENIZE_TIME, start);
+	}
+
 	const idx_t reader_idx;
 	const vector<string> column_names;
 	const vector<LogicalType> column_types;
-	unique_ptr<CsvBlock> block;
+	//! The converter of each column, resolved at bind time
+	const vector<CsvColumnConverter> converters;
+	const CsvDialect dialect;
+	//! The unescaped contents of a quoted field with escaped characters
+	string unquoted_field;
+	//! Maps a column in the file into its index in the output chunk, or DConstants::INVALID_INDEX if not projected
+	vector<idx_t> projection_map;
+	//! The number of leading columns in a row that we need to tokenize; the rest of the row is skipped
+	idx_t num_needed_columns;
+	//! Filters evaluated right after their columns are converted
+	vector<CsvReaderFilter> filters;
+	//! Projected columns without filters, which are only converted for the rows passing the filters
+	vector<idx_t> materialized_columns;
+	//! Offsets and lengths of the fields found by TokenizeRow
+	vector<idx_t> field_starts;
+	vector<idx_t> field_lengths;
+	//! Whether to parse in two phases with FlushColumns
+	const bool columnar;
+	//! Whether to build the structural index with the SIMD kernel instead of the scalar one
+	const bool simd;
+	//! The filter and materialized columns, which are the columns kept in the field matrix
+	vector<idx_t> tokenized_columns;
+	//! The field matrix of FlushColumns: the offsets and lengths of the fields of a column in the rows of a chunk.
+	//! Only the tokenized columns have their entries; a missing field has a length of 0.
+	vector<vector<idx_t>> column_field_starts;
+	vector<vector<idx_t>> column_field_lengths;
+	//! VARCHAR values point into the block instead of being copied into the vectors
+	shared_ptr<CsvBlock> block;
+	buffer_ptr<VectorBuffer> block_vector_buffer;
 	idx_t current_buffer_pos;
+	//! Only the rows numbered in [row_offset, row_end) are returned; row numbers come from the line index
+	const idx_t row_offset;
+	const idx_t row_end;
+	//! The number of the row at the current position, or DConstants::INVALID_INDEX if the block has no row numbers
+	idx_t current_row;
+	//! Positions of the delimiters and newlines outside quotes in the current block
+	CsvStructuralIndex structural_index;
+	//! The number of the rows tokenized since the last TakeParsedRowCount()
+	idx_t num_parsed_rows = 0;
+	//! Set while the rows of the block are flushed with the statistics of its zone map collected along the way, in
+	//! which case every column of every row is tokenized and converted regardless of the projection and filters
+	bool collect_statistics = false;
+	vector<BaseStatistics> block_statistics;
+	vector<idx_t> block_null_counts;
+	idx_t block_row_count = 0;
+	//! The values of the columns that the output does not have, which are converted for the statistics only
+	vector<Vector> statistics_values;
+	//! The counters of the thread that owns this reader
+	CsvScanStats &stats;
 };
 
 struct ScanCsvOptions {
+	//! The max block size, which is also the block size if it is given explicitly
 	idx_t buffer_size = CsvBlockIterator::CSV_BUFFER_SIZE;
+	//! Whether blocks start small and grow up to a size picked by the file size and the number of threads;
+	//! otherwise, every block has `buffer_size` bytes
+	bool adaptive_block_size = true;
+	//! Whether threads claim byte ranges and read them without holding the global lock
+	bool parallel_read = true;
+	//! Whether to back block buffers with transparent huge pages (Linux only)
+	bool huge_pages = false;
+	//! Whether to map a local file into memory and use views into it as blocks
+	bool mmap = false;
+	//! The max number of blocks read ahead (0 disables read-ahead): on a background thread for a file read in order,
+	//! and by hints to the OS for the blocks that the threads reading a file in parallel claim next
+	idx_t read_ahead = 0;
+	//! Whether to cut blocks at the row offsets in the sidecar line index of the file if it exists (see
+	//! csv_build_line_index)
+	bool line_index = false;
+	//! The number of rows to skip and the max number of rows to return. The scan seeks to them through the line index
+	//! if it exists (or `line_index` is set), and otherwise counts the rows before them.
+	idx_t row_offset = 0;
+	idx_t row_limit = NumericLimits<idx_t>::Maximum();
+	//! Whether to collect per-block statistics and skip blocks by them (parallel read modes only)
+	bool zone_map = false;
+	//! Whether to tokenize a vector's worth of rows before converting them a column at a time
+	bool columnar = false;
+	//! Whether to build the structural index with the SIMD kernel of the CPU; false forces the scalar kernel, e.g., to
+	//! check the SIMD kernels against it
+	bool simd = true;
+	//! The compression of the files; AUTO_DETECT picks it by the file extension
+	FileCompressionType compression = FileCompressionType::AUTO_DETECT;
+	//! The delimiter, quote, and escape characters
+	CsvDialect dialect;
+	//! Whether to keep the decoded rows in memory and serve later scans of the same files from them
+	bool cache = false;
+	//! Whether to read the rows from a columnar copy next to a single file, writing it on the first full scan
+	bool columnar_sidecar = false;
+	//! Whether to read only the complete rows appended to a single file since the previous incremental scan
+	bool incremental = false;
 };
 
 struct ScanCsvBindData : public TableFunctionData {
 public:
 	explicit ScanCsvBindData(const vector<string> &column_names_p, const vector<LogicalType> &column_types_p,
-	                         const ScanCsvOptions &options_p, shared_ptr<FileHandle> file_handle_p)
-		: column_names(column_names_p), column_types(column_types_p), options(options_p), file_handle(file_handle_p) {
+	                         const ScanCsvOptions &options_p, vector<string> files_p,
+	                         shared_ptr<FileHandle> file_handle_p)
+		: column_names(column_names_p), column_types(column_types_p), options(options_p), files(std::move(files_p)),
+		  file_handle(file_handle_p) {
+		for (auto &type : column_types) {
+			converters.push_back(CsvColumnConverter::Get(type));
+		}
+		// The line index has the offsets of the rows in the decompressed data, which we cannot seek to. It is only
+		// built by csv_build_line_index, so that binding never scans the whole file; without it, the rows before a
+		// row range are counted.
+		auto has_row_range = options.row_offset > 0 || options.row_limit != NumericLimits<idx_t>::Maximum();
+		if (GetCompression(0) == FileCompressionType::UNCOMPRESSED && (options.line_index || has_row_range)) {
+			line_index = CsvLineIndex::TryLoad(*file_handle, options.dialect);
+		}
 	};
 
+	//! Expands the glob patterns into the files to scan and opens the first one
+	static unique_ptr<ScanCsvBindData> Create(ClientContext &context, const vector<string> &patterns,
+	                                          const vector<string> &column_names,
+	                                          const vector<LogicalType> &column_types, const ScanCsvOptions &options);
+
+	//! Returns the statistics of the column if a complete zone map of the (single) file is available
+	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_index) const;
+
+	//! Returns the number of rows to scan: exact if the line index or a complete zone map is available,
+	//! otherwise estimated from samples of the (first) file
+	unique_ptr<NodeStatistics> GetCardinality(ClientContext &context) const;
+
+	FileCompressionType GetCompression(idx_t file_idx) const {
+		return CsvFrameIndex::GetCompression(files[file_idx], options.compression);
+	}
+
 	const vector<string> column_names;
 	const vector<LogicalType> column_types;
+	//! The converter of each column
+	vector<CsvColumnConverter> converters;
 	const ScanCsvOptions options;
+	//! The files matching the glob patterns
+	const vector<string> files;
 
+	//! The (raw) handle of the first file; the other files are opened when the scan reaches them
 	shared_ptr<FileHandle> file_handle;
+	//! Set if the line index is enabled (or a row range is given) and the first file has an up-to-date index
+	shared_ptr<CsvLineIndex> line_index;
 };
 
 } // namespace duckdb
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_structural_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "csv_dialect.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace duckdb {
+
+//! Bitmask of the structural characters (delimiters and newlines) in a CSV block.
+//! The i-th bit is set if the i-th byte of the block is a structural character outside quotes.
+struct CsvStructuralIndex {
+public:
+	//! Builds the index over `len` bytes of `data`, which start outside quotes. The SIMD kernel is picked at
+	//! runtime unless `simd` is false, which forces the scalar one; the quoted parts are masked out only if the
+	//! block has a quote.
+	void Build(const char *data, idx_t len, const CsvDialect &dialect, bool simd);
+
+	//! Whether the block has a quote, i.e., whether its fields may need unquoting
+	bool HasQuotes() const {
+		return has_quotes;
+	}
+
+	//! Returns the position of the next structural character at or after `pos`, or the block size if none
+	inline idx_t NextStructuralChar(idx_t pos) const {
+		if (pos >= len) {
+			return len;
+		}
+		auto word_idx = pos / 64;
+		auto word = bitmask[word_idx] & (~uint64_t(0) << (pos % 64));
+		while (word == 0) {
+			if (++word_idx >= bitmask.size()) {
+				return len;
+			}
+			word = bitmask[word_idx];
+		}
+		return word_idx * 64 + CountTrailingZeros(word);
+	}
+
+	//! Returns the distance from `pos` to the next `target` character, or to the block end if none
+	inline idx_t FindNextTargetChar(const char *data, idx_t pos, char target) const {
+		auto next = NextStructuralChar(pos);
+		while (next < len && data[next] != target) {
+			next = NextStructuralChar(next + 1);
+		}
+		return next - pos;
+	}
+
+	//! Returns the name of the kernel used to build the index
+	static const char *GetKernelName();
+
+private:
+	static inline idx_t CountTrailingZeros(uint64_t word) {
+#if defined(_MSC_VER)
+		unsigned long idx;
+		_BitScanForward64(&idx, word);
+		return idx;
+#else
+		return __builtin_ctzll(word);
+#endif
+	}
+
+	//! Clears the bits of the structural characters in quoted fields
+	void MaskQuotedParts(const char *data, const CsvDialect &dialect);
+
+	vector<uint64_t> bitmask;
+	//! The i-th bit is set if the i-th byte is a quote
+	vector<uint64_t> quote_bitmask;
+	idx_t len = 0;
+	bool has_quotes = false;
+};
+
+} // namespace duckdb
@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// csv_zone_map.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "csv_dialect.hpp"
+#include "csv_filter.hpp"
+#include "csv_line_index.hpp"
+
+namespace duckdb {
+
+//! Per-block statistics (min/max/null count) of a CSV file, collected as a side effect of scans and kept in
+//! the object cache of the database. Block k owns the rows starting in [k * block_size, (k + 1) * block_size),
+//! which is the layout of the parallel scan modes, so the statistics of a block can be checked before reading it.
+//! A skipped block is not read, so the zone map also keeps its quote transition for the blocks after it.
+class CsvZoneMap : public ObjectCacheEntry {
+public:
+	CsvZoneMap(const CsvFileSignature &signature_p, const vector<LogicalType> &column_types_p, idx_t block_size_p,
+	           const CsvDialect &dialect_p);
+
+	//! Returns the zone map of the file in the object cache, replacing it if it does not match the file version,
+	//! the column types, the block size, or the dialect
+	static shared_ptr<CsvZoneMap> Get(ClientContext &context, FileHandle &handle,
+	                                  const vector<LogicalType> &column_types, idx_t block_size,
+	                                  const CsvDialect &dialect);
+
+	//! Whether the statistics of the block have been collected
+	bool HasBlock(idx_t block_index);
+
+	//! Stores the statistics and the number of NULLs of a block, one per column, and the number of rows in it
+	void SetBlock(idx_t block_index, vector<BaseStatistics> statistics, vector<idx_t> null_counts, idx_t row_count);
+
+	//! Marks a block as having no row
+	void SetEmptyBlock(idx_t block_index);
+
+	//! Stores the quote transition of the bytes of a block
+	void SetQuoteTransition(idx_t block_index, CsvQuoteTransition quote_transition);
+
+	//! Returns true if the block is known to have no row passing all the filters. The quote transition of a skipped
+	//! block is returned in `quote_transition`; a block is never skipped before its quote transition is known.
+	bool CanSkip(idx_t block_index, const vector<CsvReaderFilter> &filters, CsvQuoteTransition &quote_transition);
+
+	//! Returns the statistics of the column over the whole file, or nullptr until all the blocks are collected
+	unique_ptr<BaseStatistics> GetStatistics(idx_t column_idx);
+
+	//! Returns the exact number of rows in the file if all the blocks are collected
+	bool TryGetRowCount(idx_t &row_count);
+
+	//! Returns the exact number of NULLs in the column over the whole file if all the blocks are collected
+	bool TryGetNullCount(idx_t column_idx, idx_t &null_count);
+
+	//! Returns the empty statistics that SetBlock starts from
+	static BaseStatistics CreateEmptyStatistics(const LogicalType &type);
+
+	//! Adds the row-th value of the flat vector (or NULL if not valid) into the statistics
+	static void UpdateStatistics(BaseStatistics &statistics, Vector &vector, idx_t row, bool is_valid);
+
+	static string ObjectType() {
+		return "csv_zone_map";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	const CsvFileSignature signature;
+	const vector<LogicalType> column_types;
+	const idx_t block_size;
+	const CsvDialect dialect;
+
+private:
+	struct Block {
+		vector<BaseStatistics> statistics;
+		vector<idx_t> null_counts;
+	};
+
+	mutex lock;
+	//! Null if the statistics of the block have not been collected yet
+	vector<unique_ptr<Block>> blocks;
+	//! Set for the blocks that have been read
+	vector<CsvQuoteTransition> quote_transitions;
+	vector<bool> has_quote_transition;
+	idx_t num_collected_blocks;
+	//! The number of rows in the collected blocks
+	idx_t num_collected_rows;
+};
+
+} // namespace duckdb
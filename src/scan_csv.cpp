@@ -1,71 +1,561 @@
 #include "csv_scanner.hpp"
+#include "csv_cardinality.hpp"
+#include "csv_chunk_cache.hpp"
+#include "csv_columnar_file.hpp"
+#include "csv_filter.hpp"
+#include "csv_incremental_state.hpp"
 
 #include "duckdb/common/insertion_order_preserving_map.hpp"
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/extension_util.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
 
 struct CsvGlobalState : public GlobalTableFunctionState {
 public:
-	CsvGlobalState(idx_t system_threads_p, unique_ptr<CsvBlockIterator> csv_block_iterator_p)
-	: system_threads(system_threads_p), csv_block_iterator(std::move(csv_block_iterator_p)),
-	  reader_idx(0), finished(false) {
+	CsvGlobalState(ClientContext &context_p, const ScanCsvBindData &bind_data_p, idx_t system_threads_p,
+	               vector<CsvReaderFilter> filters_p, const vector<column_t> &column_ids)
+	: context(context_p), bind_data(bind_data_p), system_threads(system_threads_p),
+	  zone_map_filters(bind_data.options.zone_map ? filters_p : vector<CsvReaderFilter>()),
+	  next_file_idx(0), num_finished_files(0), next_batch_index(0), reader_idx(0), finished(false), num_blocks(0),
+	  num_flushed_blocks(0), num_cached_chunks(0), row_group_filters(std::move(filters_p)), next_row_group(0),
+	  num_read_row_groups(0), start_offset(0), end_offset(0), num_parsed_rows(0), incremental_scan_added(false) {
+		// Each thread holds a block and the previous one can be still referenced by its output vectors.
+		// The buffers are recycled across all the files in this scan.
+		auto &options = bind_data.options;
+		buffer_pool = make_shared_ptr<CsvBufferPool>(BufferAllocator::Get(context),
+		                                             system_threads * 2 + options.read_ahead, options.huge_pages);
+		if (options.incremental) {
+			// An incremental scan reads only the rows appended since the previous one, which no cache has
+			incremental_state = CsvIncrementalState::Get(context, bind_data.files[0], options.dialect);
+			start_offset = incremental_state->GetStartOffset(*bind_data.file_handle);
+			return;
+		}
+		// A scan of a row range does not read all the rows, so it neither uses nor fills the caches
+		auto has_row_range = options.row_offset > 0 || options.row_limit != NumericLimits<idx_t>::Maximum();
+		if (!has_row_range) {
+			InitializeCaches(column_ids);
+		}
 	}
 
-	unique_ptr<CsvBlock> Next() {
-		lock_guard<mutex> lock(main_mutex);
-		auto block = csv_block_iterator->Next();
-		if (!block) {
+	~CsvGlobalState() override {
+		try {
+			CsvScanStatsHistory::Get(context)->Add(bind_data.files[0], bind_data.files.size(), GetThreadStats());
+		} catch (std::exception &) {
+			// The history is for diagnostics only, so failing to record this scan (e.g., out of memory) is not fatal
+		}
+		if (!IsComplete()) {
+			return;
+		}
+		if (cache_builder) {
+			try {
+				cache_builder->Publish();
+			} catch (std::exception &) {
+				// The cache only speeds up later scans, so a failed copy (e.g., out of memory) does not fail this one
+			}
+		}
+		if (sidecar_writer) {
+			try {
+				sidecar_writer->Finish();
+			} catch (std::exception &) {
+				// The sidecar only speeds up later scans, so a failed write does not fail this one
+			}
+		}
+	}
+
+	//! Returns the next block in the current file, moving on to the next file once the current one is exhausted.
+	//! Threads finishing the blocks of a file start on the next one while others still parse the last blocks.
+	//! The time spent on the lock and on reading goes to the counters of the calling thread.
+	unique_ptr<CsvBlock> Next(CsvScanStats &stats) {
+		while (true) {
+			shared_ptr<CsvBlockIterator> iterator;
+			{
+				auto lock_start = CsvScanStats::Now();
+				lock_guard<mutex> lock(main_mutex);
+				stats.AddTime(CsvScanCounter::LOCK_WAIT_TIME, lock_start);
+				if (!current_iterator) {
+					if (next_file_idx >= bind_data.files.size()) {
+						finished = true;
+						return nullptr;
+					}
+					current_iterator = OpenFile(next_file_idx++);
+				}
+				iterator = current_iterator;
+				if (!iterator->IsParallel()) {
+					auto block = ReadBlock(*iterator, stats);
+					if (block) {
+						return block;
+					}
+					FinishFile(iterator);
+					continue;
+				}
+			}
+			// Byte ranges are claimed atomically, so reads can run in parallel without the lock
+			auto block = ReadBlock(*iterator, stats);
+			if (block) {
+				return block;
+			}
+			lock_guard<mutex> lock(main_mutex);
+			FinishFile(iterator);
+		}
+	}
+
+	//! Whether every block has been handed out and flushed, i.e., the scan has neither failed nor been cut short
+	//! (e.g., by a LIMIT). Only then do the caches get the rows and do incremental scans consume them.
+	bool IsComplete() const {
+		return finished && num_flushed_blocks == num_blocks;
+	}
+
+	//! Called by each thread once it has no more rows. The last thread to finish a complete incremental scan hands the
+	//! rows it consumed to the transaction, which records them once it commits.
+	void FinishScan() {
+		if (!incremental_state || !IsComplete() || incremental_scan_added.exchange(true)) {
+			return;
+		}
+		CsvIncrementalCommitState::AddScan(context, incremental_state, *bind_data.file_handle, start_offset, end_offset,
+		                                   num_parsed_rows);
+	}
+
+	//! Marks a block returned by Next() or a row group returned by ReadRowGroup() as fully flushed, with the number
+	//! of the rows parsed in it
+	void FinishBlock(idx_t num_rows = 0) {
+		num_parsed_rows += num_rows;
+		num_flushed_blocks++;
+	}
+
+	//! Reads the next row group of the sidecar that may have rows passing the filters. Returns false once all the
+	//! row groups are handed out.
+	bool ReadRowGroup(vector<unique_ptr<DataChunk>> &chunks, idx_t &first_row, CsvScanStats &stats) {
+		while (true) {
+			auto row_group_idx = next_row_group++;
+			if (row_group_idx >= sidecar->row_groups.size()) {
+				finished = true;
+				return false;
+			}
+			if (sidecar->CanSkip(row_group_idx, row_group_filters)) {
+				stats.Add(CsvScanCounter::SKIPPED_BLOCKS, 1);
+				num_read_row_groups++;
+				continue;
+			}
+			chunks = sidecar->ReadRowGroup(row_group_idx, source_column_ids);
+			first_row = sidecar->row_groups[row_group_idx].first_row;
+			num_blocks++;
+			num_read_row_groups++;
+			return true;
+		}
+	}
+
+	//! Scans the next chunk of the cached rows; returns false once all the chunks are handed out
+	bool ScanCache(ColumnDataLocalScanState &local_scan_state, DataChunk &chunk) {
+		if (!chunk_cache->collection->Scan(cache_scan_state, local_scan_state, chunk)) {
 			finished = true;
+			return false;
+		}
+		num_cached_chunks++;
+		return true;
+	}
+
+	//! Whether the rows are served from the cache instead of the files
+	bool IsServedFromCache() const {
+		return chunk_cache != nullptr;
+	}
+
+	//! Whether the rows are served from the columnar sidecar instead of the file
+	bool IsServedFromSidecar() const {
+		return sidecar != nullptr;
+	}
+
+	//! Appends a chunk with all the columns from the block with the batch index to the caches being filled; the rows
+	//! for the chunk cache go to the batch of the thread until the block is done
+	void CollectRows(CsvChunkCacheBatch &cache_batch, idx_t batch_index, DataChunk &chunk) {
+		if (cache_builder) {
+			cache_builder->Append(cache_batch, batch_index, chunk);
+		}
+		if (sidecar_writer) {
+			sidecar_writer->Append(batch_index, chunk);
 		}
-		return block;
+	}
+
+	//! Marks all the rows of the block with the batch index as collected
+	void FinishCollecting(CsvChunkCacheBatch &cache_batch, idx_t batch_index) {
+		if (cache_builder) {
+			cache_builder->FinishBatch(cache_batch);
+		}
+		if (sidecar_writer) {
+			sidecar_writer->FinishBatch(batch_index);
+		}
+	}
+
+	//! The columns of the chunks that the output is derived from, or empty if readers fill the output directly
+	const vector<column_t> &GetSourceColumnIds() const {
+		return source_column_ids;
 	}
 
 	//! Returns Current Progress of this CSV Read
 	double GetProgress() const {
-		return csv_block_iterator->GetProgress();
+		if (chunk_cache) {
+			return 100.0 * num_cached_chunks / MaxValue<idx_t>(chunk_cache->collection->ChunkCount(), 1);
+		}
+		if (sidecar) {
+			return 100.0 * MinValue<idx_t>(num_read_row_groups, sidecar->row_groups.size()) /
+			       MaxValue<idx_t>(sidecar->row_groups.size(), 1);
+		}
+		lock_guard<mutex> lock(main_mutex);
+		double progress = num_finished_files;
+		if (current_iterator) {
+			progress += current_iterator->GetProgress() / 100.0;
+		}
+		return 100.0 * progress / bind_data.files.size();
 	}
 
 	//! Calculates the Max Threads that will be used by this CSV Scanner
 	idx_t MaxThreads() const override {
-		idx_t total_threads = csv_block_iterator->GetFileSize() / csv_block_iterator->GetBufferSize() + 1;
+		if (chunk_cache) {
+			return MinValue<idx_t>(system_threads, MaxValue<idx_t>(chunk_cache->collection->ChunkCount(), 1));
+		}
+		if (sidecar) {
+			return MinValue<idx_t>(system_threads, MaxValue<idx_t>(sidecar->row_groups.size(), 1));
+		}
+		// Blocks are handed out across files, so small files do not cap the parallelism of a multi-file scan.
+		// The decompressed size of a compressed file is unknown here, so it does not cap the parallelism either.
+		if (bind_data.files.size() > 1 || bind_data.GetCompression(0) != FileCompressionType::UNCOMPRESSED) {
+			return system_threads;
+		}
+		auto file_size = bind_data.file_handle->GetFileSize();
+		idx_t first_block_size, block_size;
+		GetBlockSizes(file_size, bind_data.options.zone_map, first_block_size, block_size);
+		idx_t total_threads = CsvBlockIterator::CutRanges(file_size, first_block_size, block_size).size();
 		if (total_threads < system_threads) {
 			return total_threads;
 		}
 		return system_threads;
 	}
 
+	//! Picks the size of the first block of a file and the size that its blocks grow to. Blocks grow so that the
+	//! first rows come back fast and later blocks amortize their costs, up to a size that still spreads the file
+	//! across the threads.
+	void GetBlockSizes(idx_t file_size, bool has_zone_map, idx_t &first_block_size, idx_t &block_size) const {
+		auto &options = bind_data.options;
+		first_block_size = options.buffer_size;
+		block_size = options.buffer_size;
+		// The blocks of a zone map are cut at multiples of the buffer size
+		if (!options.adaptive_block_size || has_zone_map) {
+			return;
+		}
+		block_size = CsvBlockIterator::GetTargetBlockSize(file_size, system_threads, options.buffer_size);
+		first_block_size = MinValue<idx_t>(CsvBlockIterator::FIRST_BLOCK_SIZE, block_size);
+	}
+
 	const idx_t NextCsvReaderIndex() {
 		return reader_idx++;
 	}
 
+	//! Returns the counters of a new thread of this scan, which live as long as this state
+	CsvScanStats &AddThreadStats() {
+		lock_guard<mutex> lock(stats_lock);
+		thread_stats.push_back(make_uniq<CsvScanStats>());
+		return *thread_stats.back();
+	}
+
+	vector<reference<const CsvScanStats>> GetThreadStats() const {
+		lock_guard<mutex> lock(stats_lock);
+		vector<reference<const CsvScanStats>> result;
+		for (auto &stats : thread_stats) {
+			result.push_back(*stats);
+		}
+		return result;
+	}
+
 	bool IsDone() {
-		lock_guard<mutex> lock(main_mutex);
 		return finished;
 	}
 
 private:
+	//! Serves the scan from the cached rows or the columnar sidecar if they are up to date, and collects the rows
+	//! of this scan into the enabled caches that are not
+	void InitializeCaches(const vector<column_t> &column_ids) {
+		auto &options = bind_data.options;
+		if (options.cache) {
+			chunk_cache = CsvChunkCache::TryGet(context, bind_data.files, bind_data.column_types, options.dialect);
+			if (chunk_cache) {
+				SetSourceColumnIds(column_ids, false);
+				chunk_cache->collection->InitializeScan(cache_scan_state, source_column_ids);
+				return;
+			}
+			cache_builder =
+			    make_uniq<CsvChunkCacheBuilder>(context, bind_data.files, bind_data.column_types, options.dialect);
+		}
+		// The sidecar is a copy of a single file, so a pipe has none
+		auto &file_handle = *bind_data.file_handle;
+		if (options.columnar_sidecar && bind_data.files.size() == 1 && file_handle.CanSeek() && !file_handle.IsPipe()) {
+			auto &fs = FileSystem::GetFileSystem(context);
+			auto signature = CsvFileSignature::Get(file_handle);
+			sidecar = CsvColumnarFile::TryOpen(fs, bind_data.files[0], signature, bind_data.column_types,
+			                                   options.dialect);
+			if (!sidecar) {
+				try {
+					sidecar_writer =
+					    make_uniq<CsvColumnarWriter>(fs, BufferManager::GetBufferManager(context), bind_data.files[0],
+					                                 signature, bind_data.column_types, options.dialect);
+				} catch (std::exception &) {
+					// The scan goes on without writing the sidecar (e.g., in a read-only directory)
+				}
+			}
+		}
+		// The caches being filled need all the columns of all the rows, so nothing is skipped
+		auto collects_rows = cache_builder || sidecar_writer;
+		if (collects_rows) {
+			zone_map_filters.clear();
+			row_group_filters.clear();
+		}
+		if (sidecar || collects_rows) {
+			SetSourceColumnIds(column_ids, collects_rows);
+		}
+	}
+
+	//! Sets the columns of the chunks that the output is derived from: all the columns if the rows are collected,
+	//! otherwise the columns in `column_ids` without the row id
+	void SetSourceColumnIds(const vector<column_t> &column_ids, bool all_columns) {
+		for (idx_t i = 0; i < bind_data.column_types.size(); i++) {
+			if (all_columns || std::find(column_ids.begin(), column_ids.end(), i) != column_ids.end()) {
+				source_column_ids.push_back(i);
+			}
+		}
+		if (source_column_ids.empty()) {
+			// The row counts of the chunks are still needed without columns (e.g., `SELECT count(*)`)
+			source_column_ids.push_back(0);
+		}
+	}
+
+	//! Opens the file lazily when the scan reaches it
+	shared_ptr<CsvBlockIterator> OpenFile(idx_t file_idx) {
+		auto &options = bind_data.options;
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto &path = bind_data.files[file_idx];
+		auto compression = bind_data.GetCompression(file_idx);
+		// The first file has been opened at bind time
+		auto file_handle = bind_data.file_handle;
+		auto line_index = bind_data.line_index;
+		if (file_idx > 0) {
+			file_handle = shared_ptr<FileHandle>(fs.OpenFile(path, FileFlags::FILE_FLAGS_READ));
+			line_index = options.line_index && compression == FileCompressionType::UNCOMPRESSED
+			                 ? CsvLineIndex::TryLoad(*file_handle, options.dialect)
+			                 : nullptr;
+		}
+		shared_ptr<CsvFrameIndex> frame_index;
+		shared_ptr<CsvZoneMap> zone_map;
+		// Without a line index, the rows of a row range are numbered by counting the rows of the blocks in order
+		auto has_row_range = options.row_offset > 0 || options.row_limit != NumericLimits<idx_t>::Maximum();
+		auto counts_rows = has_row_range && !line_index;
+		// The compressed size, since the decompressed size of a stream is unknown
+		auto file_size = file_handle->GetFileSize();
+		if (compression != FileCompressionType::UNCOMPRESSED) {
+			if (!counts_rows) {
+				frame_index = CsvFrameIndex::TryBuild(*file_handle, compression);
+			}
+			if (!frame_index) {
+				// A single stream is decompressed front to back through the compressed file systems of DuckDB
+				file_handle = shared_ptr<FileHandle>(fs.OpenFile(path, FileFlags::FILE_FLAGS_READ | compression));
+			}
+		} else if (options.zone_map && !counts_rows) {
+			zone_map = CsvZoneMap::Get(context, *file_handle, bind_data.column_types, options.buffer_size,
+			                           options.dialect);
+		}
+		idx_t first_block_size, block_size;
+		GetBlockSizes(file_size, zone_map != nullptr, first_block_size, block_size);
+		return make_shared_ptr<CsvBlockIterator>(buffer_pool, std::move(file_handle), block_size, first_block_size,
+		                                         options.dialect, options.parallel_read && !counts_rows,
+		                                         options.mmap && !counts_rows,
+		                                         options.read_ahead,
+		                                         std::move(line_index), std::move(frame_index), options.row_offset,
+		                                         options.row_limit, std::move(zone_map), zone_map_filters,
+		                                         next_batch_index, start_offset, options.incremental);
+	}
+
+	unique_ptr<CsvBlock> ReadBlock(CsvBlockIterator &iterator, CsvScanStats &stats) {
+		auto start = CsvScanStats::Now();
+		auto block = iterator.Next();
+		stats.AddTime(CsvScanCounter::READ_TIME, start);
+		stats.Add(CsvScanCounter::SKIPPED_BLOCKS, iterator.TakeSkippedBlockCount());
+		if (block) {
+			stats.Add(CsvScanCounter::BYTES_READ, block->GetSize());
+			stats.Add(CsvScanCounter::BLOCKS, 1);
+			num_blocks++;
+		}
+		return block;
+	}
+
+	//! Moves on to the next file if the iterator is still the current one; the caller holds the lock
+	void FinishFile(const shared_ptr<CsvBlockIterator> &iterator) {
+		if (current_iterator == iterator) {
+			if (incremental_state) {
+				end_offset = iterator->GetReadOffset();
+			}
+			// The blocks of the next file are ordered after all the blocks of this one
+			next_batch_index += iterator->GetBatchCount();
+			current_iterator = nullptr;
+			num_finished_files++;
+		}
+	}
+
+	ClientContext &context;
+	const ScanCsvBindData &bind_data;
+
 	//! Because this global state can be accessed in Parallel we need a mutex.
-	mutex main_mutex;
+	mutable mutex main_mutex;
 
 	//! Basically max number of threads in DuckDB
 	idx_t system_threads;
 
-	//! The CSV block iterator
-	unique_ptr<CsvBlockIterator> csv_block_iterator;
+	//! Shared by the block iterators of all the files
+	shared_ptr<CsvBufferPool> buffer_pool;
+	vector<CsvReaderFilter> zone_map_filters;
+
+	//! The CSV block iterator of the file being read
+	shared_ptr<CsvBlockIterator> current_iterator;
+	idx_t next_file_idx;
+	idx_t num_finished_files;
+	//! The batch index of the first block of the next file
+	idx_t next_batch_index;
 	atomic<idx_t> reader_idx;
-	bool finished;
+	atomic<bool> finished;
+
+	//! The number of blocks (or row groups) handed out and fully flushed by the local states
+	atomic<idx_t> num_blocks;
+	atomic<idx_t> num_flushed_blocks;
+	vector<column_t> source_column_ids;
+
+	//! The cached rows this scan is served from, if any
+	shared_ptr<CsvChunkCache> chunk_cache;
+	ColumnDataParallelScanState cache_scan_state;
+	atomic<idx_t> num_cached_chunks;
+	//! Collects the rows of this scan if the cache is enabled but has no up-to-date rows
+	unique_ptr<CsvChunkCacheBuilder> cache_builder;
+
+	//! The columnar sidecar this scan is served from, if any
+	unique_ptr<CsvColumnarFile> sidecar;
+	vector<CsvReaderFilter> row_group_filters;
+	atomic<idx_t> next_row_group;
+	atomic<idx_t> num_read_row_groups;
+	//! Writes the rows of this scan if the sidecar is enabled but missing or stale
+	unique_ptr<CsvColumnarWriter> sidecar_writer;
+
+	//! Set if the scan is incremental: it reads the complete rows in [start_offset, end_offset), which become the
+	//! rows consumed by the incremental scans once this scan has read them all and its transaction commits
+	shared_ptr<CsvIncrementalState> incremental_state;
+	idx_t start_offset;
+	idx_t end_offset;
+	atomic<idx_t> num_parsed_rows;
+	atomic<bool> incremental_scan_added;
+
+	//! The counters of each thread, which are recorded in the history of the scans once this scan ends
+	mutable mutex stats_lock;
+	vector<unique_ptr<CsvScanStats>> thread_stats;
 };
 
 struct CsvLocalState : public LocalTableFunctionState {
 public:
-	CsvLocalState(unique_ptr<CsvReader> csv_reader_p)
-	: csv_reader(std::move(csv_reader_p)) {
+	CsvLocalState(unique_ptr<CsvReader> csv_reader_p, CsvScanStats &stats_p)
+	: csv_reader(std::move(csv_reader_p)), stats(stats_p) {
+	}
+
+	//! Makes the scan go through a source chunk instead of the output. `source_columns` has the column in the source
+	//! for each output column (INVALID_INDEX for the row id). Rows in the source are not filtered yet.
+	void InitializeSource(ClientContext &context, const vector<LogicalType> &source_types,
+	                      vector<idx_t> source_columns_p, vector<CsvReaderFilter> filters_p) {
+		source.Initialize(context, source_types);
+		source_columns = std::move(source_columns_p);
+		filters = std::move(filters_p);
+		has_source = true;
 	}
 
-	//! The CSV reader
+	//! Fills the output with the columns of the source and drops the rows that do not pass the filters
+	void ProjectAndFilter(DataChunk &output) {
+		for (idx_t i = 0; i < source_columns.size(); i++) {
+			if (source_columns[i] != DConstants::INVALID_INDEX) {
+				output.data[i].Reference(source.data[source_columns[i]]);
+			}
+		}
+		output.SetCardinality(source.size());
+		if (filters.empty()) {
+			return;
+		}
+		for (auto &filter : filters) {
+			filter.Snapshot();
+		}
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		idx_t count = 0;
+		for (idx_t row = 0; row < source.size(); row++) {
+			bool passed = true;
+			for (auto &filter : filters) {
+				if (!CsvFilter::Evaluate(filter.Get(), output.data[filter.output_idx], row)) {
+					passed = false;
+					break;
+				}
+			}
+			if (passed) {
+				sel.set_index(count++, row);
+			}
+		}
+		if (count < source.size()) {
+			output.Slice(sel, count);
+		}
+	}
+
+	//! Fills the row id columns of the output with NULL, since the row numbers of parallel blocks are not known
+	void FillRowIds(DataChunk &output) {
+		for (auto column_idx : row_id_columns) {
+			output.data[column_idx].Reference(Value(output.data[column_idx].GetType()));
+		}
+	}
+
+	//! Sets the filters that CsvFilter does not support, as an expression on the output columns
+	void InitializeResidualFilter(ClientContext &context, unique_ptr<Expression> residual_filter_p) {
+		residual_filter = std::move(residual_filter_p);
+		residual_executor = make_uniq<ExpressionExecutor>(context, *residual_filter);
+	}
+
+	//! Drops the rows of the output that do not pass the residual filter, like a FILTER above the scan would
+	void ApplyResidualFilter(DataChunk &output) {
+		if (!residual_executor || output.size() == 0) {
+			return;
+		}
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		auto count = residual_executor->SelectExpression(output, sel);
+		if (count < output.size()) {
+			output.Slice(sel, count);
+		}
+	}
+
+	//! The CSV reader; null if the scan is served from the cache or the sidecar
 	unique_ptr<CsvReader> csv_reader;
 	bool done = false;
+	//! The counters of this thread, owned by the global state
+	CsvScanStats &stats;
+
+	//! The chunk that the reader, the cache scan, or the sidecar fills when the output is derived from it
+	bool has_source = false;
+	DataChunk source;
+	vector<idx_t> source_columns;
+	//! The output columns of the row id, which neither the readers nor the source fill
+	vector<idx_t> row_id_columns;
+	vector<CsvReaderFilter> filters;
+	//! The pushed filters that CsvFilter does not support (e.g., expression filters); null if there are none
+	unique_ptr<Expression> residual_filter;
+	unique_ptr<ExpressionExecutor> residual_executor;
+	//! The number of the first row in the source, which orders the chunks of the cache and the sidecar
+	idx_t batch_index = 0;
+	//! The rows of the current block for the chunk cache being filled
+	CsvChunkCacheBatch cache_batch;
+	ColumnDataLocalScanState cache_scan_state;
+	//! The chunks of the current row group of the sidecar and the next one to emit
+	vector<unique_ptr<DataChunk>> row_group_chunks;
+	idx_t next_row_group_chunk = 0;
+	idx_t next_row_group_row = 0;
+	//! The number of the first row of the current row group, which is its batch index in the chunk cache
+	idx_t row_group_first_row = 0;
 };
 
 static void ParseSchemaFromParam(ClientContext &context, const Value &param,
@@ -83,15 +573,9 @@ static void ParseSchemaFromParam(ClientContext &context, const Value &param,
 		if (val.type().id() != LogicalTypeId::VARCHAR) {
 			throw BinderException("schema param requires a type specification as string");
 		}
-		// Only support VARCHAR/BIGINT/DOUBLE for simplicity
 		auto tpe = TransformStringToLogicalType(StringValue::Get(val), context);
-		switch (tpe.id()) {
-			case LogicalTypeId::VARCHAR:
-			case LogicalTypeId::BIGINT:
-			case LogicalTypeId::DOUBLE:
-				break;
-			default:
-				throw BinderException("scan_csv_ex only supports VARCHAR, BIGINT, and DOUBLE types");
+		if (!CsvColumnConverter::IsSupported(tpe)) {
+			throw BinderException("scan_csv_ex does not support the type %s", tpe.ToString());
 		}
 		column_types.emplace_back(tpe);
 	}
@@ -102,6 +586,7 @@ static void ParseSchemaFromParam(ClientContext &context, const Value &param,
 
 static const ScanCsvOptions ParseNamedParameters(named_parameter_map_t &in, ClientContext &context) {
 	ScanCsvOptions options;
+	bool has_escape = false;
 	for (auto &kv : in) {
 		auto loption = StringUtil::Lower(kv.first);
 		if (loption == "buffer_size") {
@@ -109,31 +594,148 @@ static const ScanCsvOptions ParseNamedParameters(named_parameter_map_t &in, Clie
 			if (options.buffer_size < 1024) {
 				throw BinderException("buffer_size must be at least 1024 bytes");
 			}
+			options.adaptive_block_size = false;
+		} else if (loption == "parallel_read") {
+			options.parallel_read = BooleanValue::Get(kv.second);
+		} else if (loption == "huge_pages") {
+			options.huge_pages = BooleanValue::Get(kv.second);
+		} else if (loption == "mmap") {
+			options.mmap = BooleanValue::Get(kv.second);
+		} else if (loption == "read_ahead") {
+			options.read_ahead = kv.second.GetValue<uint64_t>();
+		} else if (loption == "line_index") {
+			options.line_index = BooleanValue::Get(kv.second);
+		} else if (loption == "row_offset") {
+			options.row_offset = kv.second.GetValue<uint64_t>();
+		} else if (loption == "row_limit") {
+			options.row_limit = kv.second.GetValue<uint64_t>();
+		} else if (loption == "zone_map") {
+			options.zone_map = BooleanValue::Get(kv.second);
+		} else if (loption == "columnar") {
+			options.columnar = BooleanValue::Get(kv.second);
+		} else if (loption == "simd") {
+			options.simd = BooleanValue::Get(kv.second);
+		} else if (loption == "compression") {
+			options.compression = FileCompressionTypeFromString(StringValue::Get(kv.second));
+		} else if (loption == "delimiter") {
+			options.dialect.delimiter = CsvDialect::ParseChar(loption, StringValue::Get(kv.second), false);
+		} else if (loption == "quote") {
+			options.dialect.quote = CsvDialect::ParseChar(loption, StringValue::Get(kv.second), true);
+		} else if (loption == "escape") {
+			options.dialect.escape = CsvDialect::ParseChar(loption, StringValue::Get(kv.second), true);
+			has_escape = true;
+		} else if (loption == "cache") {
+			options.cache = BooleanValue::Get(kv.second);
+		} else if (loption == "columnar_sidecar") {
+			options.columnar_sidecar = BooleanValue::Get(kv.second);
+		} else if (loption == "incremental") {
+			options.incremental = BooleanValue::Get(kv.second);
 		} else {
 			throw BinderException("Unknown parameter for scan_csv_ex: %s", loption);
 		}
 	}
+	if (!has_escape) {
+		// A quote is escaped by doubling it unless another escape character is given
+		options.dialect.escape = options.dialect.quote;
+	}
+	options.dialect.Verify();
+	if (options.incremental) {
+		// Only a sequential read finds the end of the last complete row, where the next incremental scan starts
+		options.parallel_read = false;
+		options.mmap = false;
+		options.zone_map = false;
+	}
 	return options;
 }
 
+//! Returns the file paths or glob patterns in the param, which is either a string or a list of strings
+static vector<string> ParseFilesFromParam(const Value &param) {
+	vector<string> patterns;
+	auto &param_type = param.type();
+	if (param_type.id() == LogicalTypeId::VARCHAR) {
+		patterns.push_back(StringValue::Get(param));
+	} else if (param_type.id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(param)) {
+			if (child.type().id() != LogicalTypeId::VARCHAR) {
+				throw BinderException("file param requires a list of strings as input");
+			}
+			patterns.push_back(StringValue::Get(child));
+		}
+	} else {
+		throw BinderException("file param requires a string or a list of strings as input");
+	}
+	if (patterns.empty()) {
+		throw BinderException("file param requires at least a single file as input!");
+	}
+	return patterns;
+}
+
 static duckdb::unique_ptr<FunctionData> ScanCsvBind(ClientContext &context, TableFunctionBindInput &input,
                                                     vector<LogicalType> &return_types, vector<string> &names) {
 	D_ASSERT(input.inputs.size() == 2);
-	auto &file_path = StringValue::Get(input.inputs[0]);
-	auto &fs = FileSystem::GetFileSystem(context);
-	auto file_handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ);
+	auto patterns = ParseFilesFromParam(input.inputs[0]);
 	ParseSchemaFromParam(context, input.inputs[1], return_types, names);
 	auto options = ParseNamedParameters(input.named_parameters, context);
-	auto bind_data = make_uniq<ScanCsvBindData>(names, return_types, options, std::move(file_handle));
-	return std::move(bind_data);
+	return ScanCsvBindData::Create(context, patterns, names, return_types, options);
+}
+
+//! Returns true if the reader evaluates the filter; the other filters are left to the residual filter
+static bool IsReaderFilter(const vector<column_t> &column_ids, const vector<LogicalType> &column_types,
+                           idx_t output_idx, const TableFilter &filter) {
+	auto column_id = column_ids[output_idx];
+	return column_id != COLUMN_IDENTIFIER_ROW_ID && CsvFilter::IsSupported(filter, column_types[column_id]);
+}
+
+//! Filters are keyed by the index in `column_ids`, i.e., the output index
+static vector<CsvReaderFilter> GetReaderFilters(const vector<column_t> &column_ids,
+                                                const vector<LogicalType> &column_types,
+                                                optional_ptr<TableFilterSet> filters) {
+	vector<CsvReaderFilter> result;
+	if (filters) {
+		for (auto &entry : filters->filters) {
+			if (IsReaderFilter(column_ids, column_types, entry.first, *entry.second)) {
+				result.emplace_back(column_ids[entry.first], entry.first, *entry.second);
+			}
+		}
+	}
+	return result;
+}
+
+//! Returns the conjunction of the filters that the reader does not evaluate, as an expression on the output
+//! columns; null if the reader evaluates all the filters. The planner may push any filter into the scan, so we
+//! cannot reject them.
+static unique_ptr<Expression> GetResidualFilter(const vector<column_t> &column_ids,
+                                                const vector<LogicalType> &column_types,
+                                                optional_ptr<TableFilterSet> filters) {
+	unique_ptr<Expression> result;
+	if (!filters) {
+		return result;
+	}
+	for (auto &entry : filters->filters) {
+		auto column_id = column_ids[entry.first];
+		// There are no row ids to filter on
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID ||
+		    IsReaderFilter(column_ids, column_types, entry.first, *entry.second)) {
+			continue;
+		}
+		BoundReferenceExpression column(column_types[column_id], entry.first);
+		auto expression = entry.second->ToExpression(column);
+		if (result) {
+			result = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND, std::move(result),
+			                                                std::move(expression));
+		} else {
+			result = std::move(expression);
+		}
+	}
+	return result;
 }
 
 static unique_ptr<GlobalTableFunctionState> ScanCsvInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<ScanCsvBindData>();
-	auto &allocator = BufferAllocator::Get(context);
-	auto buffer_size = bind_data.options.buffer_size;
-	auto csv_block_iterator = make_uniq<CsvBlockIterator>(allocator, bind_data.file_handle, buffer_size);
-	return make_uniq<CsvGlobalState>(context.db->NumberOfThreads(), std::move(csv_block_iterator));
+	auto system_threads = context.db->NumberOfThreads();
+	return make_uniq<CsvGlobalState>(context, bind_data, system_threads,
+	                                  GetReaderFilters(input.column_ids, bind_data.column_types, input.filters),
+	                                  input.column_ids);
 }
 
 unique_ptr<LocalTableFunctionState> ScanCsvInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
@@ -146,15 +748,136 @@ unique_ptr<LocalTableFunctionState> ScanCsvInitLocal(ExecutionContext &context,
 		// nothing to do
 		return nullptr;
 	}
-	auto csv_block = global_state.Next();
-	if (!csv_block) {
-		return nullptr;
-	}
-	auto reader_idx = global_state.NextCsvReaderIndex();
 	auto &bind_data = input.bind_data->Cast<ScanCsvBindData>();
-	auto csv_reader = make_uniq<CsvReader>(reader_idx, bind_data.column_names, bind_data.column_types,
-										   std::move(csv_block));
-	return make_uniq<CsvLocalState>(std::move(csv_reader));
+	auto &options = bind_data.options;
+	auto &source_column_ids = global_state.GetSourceColumnIds();
+	auto &stats = global_state.AddThreadStats();
+	unique_ptr<CsvLocalState> local_state;
+	if (global_state.IsServedFromCache() || global_state.IsServedFromSidecar()) {
+		// No block is read; the chunks are handed out when the scan starts
+		local_state = make_uniq<CsvLocalState>(nullptr, stats);
+	} else {
+		auto csv_block = global_state.Next(stats);
+		if (!csv_block) {
+			return nullptr;
+		}
+		auto reader_idx = global_state.NextCsvReaderIndex();
+		// Readers collecting the rows into the caches parse all the columns and leave the projection and the
+		// filters to the local state
+		auto collects_rows = !source_column_ids.empty();
+		auto csv_reader = make_uniq<CsvReader>(
+		    reader_idx, bind_data.column_names, bind_data.column_types, bind_data.converters, options.dialect,
+		    collects_rows ? source_column_ids : input.column_ids,
+		    collects_rows ? optional_ptr<TableFilterSet>() : input.filters, options.row_offset, options.row_limit,
+		    options.columnar, options.simd, stats, std::move(csv_block));
+		local_state = make_uniq<CsvLocalState>(std::move(csv_reader), stats);
+	}
+	if (!source_column_ids.empty()) {
+		vector<LogicalType> source_types;
+		for (auto column_id : source_column_ids) {
+			source_types.push_back(bind_data.column_types[column_id]);
+		}
+		vector<idx_t> source_columns;
+		for (auto column_id : input.column_ids) {
+			// The row id is never a source column
+			auto it = std::find(source_column_ids.begin(), source_column_ids.end(), column_id);
+			auto source_idx = NumericCast<idx_t>(it - source_column_ids.begin());
+			source_columns.push_back(it == source_column_ids.end() ? DConstants::INVALID_INDEX : source_idx);
+		}
+		local_state->InitializeSource(context.client, source_types, std::move(source_columns),
+		                              GetReaderFilters(input.column_ids, bind_data.column_types, input.filters));
+	}
+	for (idx_t i = 0; i < input.column_ids.size(); i++) {
+		if (input.column_ids[i] == COLUMN_IDENTIFIER_ROW_ID) {
+			local_state->row_id_columns.push_back(i);
+		}
+	}
+	auto residual_filter = GetResidualFilter(input.column_ids, bind_data.column_types, input.filters);
+	if (residual_filter) {
+		local_state->InitializeResidualFilter(context.client, std::move(residual_filter));
+	}
+	return std::move(local_state);
+}
+
+//! Fills the output from the next chunks of the cached rows until some rows pass the filters
+static void ScanCachedChunks(CsvGlobalState &global_state, CsvLocalState &local_state, DataChunk &output) {
+	while (output.size() == 0) {
+		local_state.source.Reset();
+		if (!global_state.ScanCache(local_state.cache_scan_state, local_state.source)) {
+			local_state.done = true;
+			return;
+		}
+		local_state.batch_index = local_state.cache_scan_state.current_row_index;
+		local_state.ProjectAndFilter(output);
+	}
+}
+
+//! Fills the output from the next chunks of the sidecar until some rows pass the filters
+static void ScanSidecarChunks(CsvGlobalState &global_state, CsvLocalState &local_state, DataChunk &output) {
+	while (output.size() == 0) {
+		if (local_state.next_row_group_chunk == local_state.row_group_chunks.size()) {
+			if (!local_state.row_group_chunks.empty()) {
+				global_state.FinishCollecting(local_state.cache_batch, local_state.row_group_first_row);
+				global_state.FinishBlock();
+			}
+			local_state.next_row_group_chunk = 0;
+			auto start = CsvScanStats::Now();
+			auto has_row_group = global_state.ReadRowGroup(local_state.row_group_chunks, local_state.next_row_group_row,
+			                                               local_state.stats);
+			local_state.stats.AddTime(CsvScanCounter::READ_TIME, start);
+			if (!has_row_group) {
+				local_state.row_group_chunks.clear();
+				local_state.done = true;
+				return;
+			}
+			local_state.stats.Add(CsvScanCounter::BLOCKS, 1);
+			local_state.row_group_first_row = local_state.next_row_group_row;
+		}
+		auto &chunk = *local_state.row_group_chunks[local_state.next_row_group_chunk++];
+		local_state.source.Reference(chunk);
+		local_state.batch_index = local_state.next_row_group_row;
+		local_state.next_row_group_row += chunk.size();
+		// Rows read from the sidecar fill the chunk cache if it is enabled but stale
+		global_state.CollectRows(local_state.cache_batch, local_state.row_group_first_row, local_state.source);
+		local_state.ProjectAndFilter(output);
+	}
+}
+
+//! Flushes the rows of the current block into the output; returns false once the block has no more rows
+static bool FlushBlock(CsvGlobalState &global_state, CsvLocalState &local_state, DataChunk &output) {
+	auto &csv_reader = *local_state.csv_reader;
+	if (!local_state.has_source) {
+		csv_reader.Flush(output);
+		return output.size() > 0;
+	}
+	// Filling the cache: the reader flushes all the rows, and the output is derived from them
+	while (output.size() == 0) {
+		local_state.source.Reset();
+		csv_reader.Flush(local_state.source);
+		if (local_state.source.size() == 0) {
+			return false;
+		}
+		global_state.CollectRows(local_state.cache_batch, csv_reader.GetBatchIndex(), local_state.source);
+		local_state.ProjectAndFilter(output);
+	}
+	return true;
+}
+
+//! Fills the output from the blocks of the files
+static void ScanBlocks(CsvGlobalState &global_state, CsvLocalState &local_state, DataChunk &output) {
+	// A block can have no row to emit (e.g., empty lines only), so move on until we get rows
+	while (!FlushBlock(global_state, local_state, output)) {
+		if (local_state.has_source) {
+			global_state.FinishCollecting(local_state.cache_batch, local_state.csv_reader->GetBatchIndex());
+		}
+		global_state.FinishBlock(local_state.csv_reader->TakeParsedRowCount());
+		auto csv_block = global_state.Next(local_state.stats);
+		if (!csv_block) {
+			local_state.done = true;
+			return;
+		}
+		local_state.csv_reader->UpdateBlock(std::move(csv_block));
+	}
 }
 
 static void ScanCsvFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
@@ -171,23 +894,44 @@ static void ScanCsvFunction(ClientContext &context, TableFunctionInput &data_p,
 		return;
 	}
 
-	csv_local_state.csv_reader->Flush(output);
-	if (output.size() == 0) {
-		auto csv_block = csv_global_state.Next();
-		if (!csv_block) {
-			csv_local_state.done = true;
-			return;
+	// An empty output ends the scan, so move on until some rows pass the residual filter
+	while (true) {
+		if (csv_global_state.IsServedFromCache()) {
+			ScanCachedChunks(csv_global_state, csv_local_state, output);
+		} else if (csv_global_state.IsServedFromSidecar()) {
+			ScanSidecarChunks(csv_global_state, csv_local_state, output);
+		} else {
+			ScanBlocks(csv_global_state, csv_local_state, output);
 		}
-		csv_local_state.csv_reader->UpdateBlock(std::move(csv_block));
-		csv_local_state.csv_reader->Flush(output);
-		D_ASSERT(output.size() > 0);
+		csv_local_state.ApplyResidualFilter(output);
+		if (output.size() > 0 || csv_local_state.done) {
+			break;
+		}
+		output.Reset();
+	}
+	csv_local_state.FillRowIds(output);
+	if (csv_local_state.done) {
+		csv_global_state.FinishScan();
 	}
+	csv_local_state.stats.Add(CsvScanCounter::ROWS, output.size());
 }
 
 static InsertionOrderPreservingMap<string> ScanCsvToString(TableFunctionToStringInput &input) {
 	InsertionOrderPreservingMap<string> result;
 	auto &bind_data = input.bind_data->Cast<ScanCsvBindData>();
 	result["File"] = bind_data.file_handle->file_system.ExtractName(bind_data.file_handle->GetPath());
+	if (bind_data.files.size() > 1) {
+		result["Files"] = std::to_string(bind_data.files.size());
+	}
+	return result;
+}
+
+//! Adds the counters of the threads so far to the EXPLAIN ANALYZE output
+static InsertionOrderPreservingMap<string> ScanCsvDynamicToString(TableFunctionDynamicToStringInput &input) {
+	InsertionOrderPreservingMap<string> result;
+	if (input.global_state) {
+		CsvScanStats::ToString(input.global_state->Cast<CsvGlobalState>().GetThreadStats(), result);
+	}
 	return result;
 }
 
@@ -201,15 +945,24 @@ static double ScanCsvProgress(ClientContext &context, const FunctionData *bind_d
 }
 
 static OperatorPartitionData ScanCsvGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
-	auto batch_idx = (input.local_state->Cast<CsvLocalState>()).csv_reader->GetReaderIndex();
-	return OperatorPartitionData(batch_idx);
+	auto &local_state = input.local_state->Cast<CsvLocalState>();
+	if (!local_state.csv_reader) {
+		// Chunks of the cache and the sidecar are ordered by their first row
+		return OperatorPartitionData(local_state.batch_index);
+	}
+	// Blocks are numbered in file order, so order-preserving sinks (e.g., INSERT and COPY) can run in parallel
+	return OperatorPartitionData(local_state.csv_reader->GetBatchIndex());
+}
+
+static unique_ptr<BaseStatistics> ScanCsvStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                    column_t column_index) {
+	auto &bind_data = bind_data_p->Cast<ScanCsvBindData>();
+	return bind_data.GetStatistics(context, column_index);
 }
 
 static unique_ptr<NodeStatistics> ScanCsvCardinality(ClientContext &context, const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<ScanCsvBindData>();
-	auto estimated_row_width = bind_data.column_names.size() * 5;
-	auto per_file_cardinality = bind_data.file_handle->GetFileSize() / estimated_row_width;
-	return make_uniq<NodeStatistics>(per_file_cardinality);
+	return bind_data.GetCardinality(context);
 }
 
 static void ScanCsvSerializer(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
@@ -223,6 +976,23 @@ static unique_ptr<FunctionData> ScanCsvDeserializer(Deserializer &deserializer,
 
 static void ScanCsvAddNamedParameters(TableFunction &table_function) {
 	table_function.named_parameters["buffer_size"] = LogicalType::UBIGINT;
+	table_function.named_parameters["parallel_read"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["huge_pages"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["mmap"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["read_ahead"] = LogicalType::UBIGINT;
+	table_function.named_parameters["line_index"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["row_offset"] = LogicalType::UBIGINT;
+	table_function.named_parameters["row_limit"] = LogicalType::UBIGINT;
+	table_function.named_parameters["zone_map"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["compression"] = LogicalType::VARCHAR;
+	table_function.named_parameters["columnar"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["simd"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["delimiter"] = LogicalType::VARCHAR;
+	table_function.named_parameters["quote"] = LogicalType::VARCHAR;
+	table_function.named_parameters["escape"] = LogicalType::VARCHAR;
+	table_function.named_parameters["cache"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["columnar_sidecar"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["incremental"] = LogicalType::BOOLEAN;
 }
 
 void CsvScannerFunction::RegisterFunction(DatabaseInstance &db) {
@@ -232,124 +1002,1055 @@ void CsvScannerFunction::RegisterFunction(DatabaseInstance &db) {
 }
 
 CsvScanFunction::CsvScanFunction()
-	: TableFunction("scan_csv_ex", {LogicalType::VARCHAR, LogicalType::ANY},
+	: TableFunction("scan_csv_ex", {LogicalType::ANY, LogicalType::ANY},
 	                ScanCsvFunction, ScanCsvBind, ScanCsvInitGlobal, ScanCsvInitLocal) {
 	to_string = ScanCsvToString;
+	dynamic_to_string = ScanCsvDynamicToString;
 	table_scan_progress = ScanCsvProgress;
 	get_partition_data = ScanCsvGetPartitionData;
 	cardinality = ScanCsvCardinality;
+	statistics = ScanCsvStatistics;
 	serialize = ScanCsvSerializer;
 	deserialize = ScanCsvDeserializer;
 	global_initialization = TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
-	projection_pushdown = false;
-	filter_pushdown = false;
+	projection_pushdown = true;
+	filter_pushdown = true;
 	pushdown_complex_filter = nullptr;
 	type_pushdown = nullptr;
 }
 
-CsvBlockIterator::CsvBlockIterator(Allocator &allocator, shared_ptr<FileHandle> file_handle_p, idx_t buffer_size)
-	: allocator(allocator), file_handle(std::move(file_handle_p)), current_file_pos(0), buffer_size(buffer_size) {
+unique_ptr<ScanCsvBindData> ScanCsvBindData::Create(ClientContext &context, const vector<string> &patterns,
+                                                    const vector<string> &column_names,
+                                                    const vector<LogicalType> &column_types,
+                                                    const ScanCsvOptions &options) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	vector<string> files;
+	for (auto &pattern : patterns) {
+		auto matches = fs.GlobFiles(pattern, context, FileGlobOptions::DISALLOW_EMPTY);
+		files.insert(files.end(), matches.begin(), matches.end());
+	}
+	auto has_row_range = options.row_offset > 0 || options.row_limit != NumericLimits<idx_t>::Maximum();
+	if (has_row_range && files.size() > 1) {
+		throw BinderException("row_offset and row_limit are only supported for a single file");
+	}
+	// Only the first file is opened here; the others are opened when the scan reaches them
+	auto file_handle = fs.OpenFile(files[0], FileFlags::FILE_FLAGS_READ);
+	auto bind_data =
+	    make_uniq<ScanCsvBindData>(column_names, column_types, options, std::move(files), std::move(file_handle));
+	if (options.incremental) {
+		if (bind_data->files.size() > 1) {
+			throw BinderException("incremental is only supported for a single file");
+		}
+		if (options.line_index || bind_data->GetCompression(0) != FileCompressionType::UNCOMPRESSED ||
+		    !bind_data->file_handle->CanSeek() || bind_data->file_handle->IsPipe()) {
+			throw BinderException("incremental requires an uncompressed, seekable file without a line index: %s",
+			                      bind_data->files[0]);
+		}
+	}
+	return bind_data;
+}
+
+unique_ptr<BaseStatistics> ScanCsvBindData::GetStatistics(ClientContext &context, column_t column_index) const {
+	// The zone map of a single file is not enough to tell the statistics of the others
+	if (!options.zone_map || files.size() > 1 || column_index >= column_types.size()) {
+		return nullptr;
+	}
+	auto zone_map = CsvZoneMap::Get(context, *file_handle, column_types, options.buffer_size, options.dialect);
+	return zone_map->GetStatistics(column_index);
+}
+
+unique_ptr<NodeStatistics> ScanCsvBindData::GetCardinality(ClientContext &context) const {
+	if (options.incremental) {
+		// Only the bytes appended since the previous incremental scan are read
+		auto incremental_state = CsvIncrementalState::Get(context, files[0], options.dialect);
+		auto new_rows = incremental_state->EstimateNewRows(file_handle->GetFileSize());
+		if (new_rows != DConstants::INVALID_INDEX) {
+			return make_uniq<NodeStatistics>(new_rows);
+		}
+	}
+	idx_t row_count;
+	bool is_exact = files.size() == 1;
+	if (line_index) {
+		row_count = line_index->row_count;
+	} else if (!options.zone_map || GetCompression(0) != FileCompressionType::UNCOMPRESSED ||
+	           !CsvZoneMap::Get(context, *file_handle, column_types, options.buffer_size, options.dialect)
+	                ->TryGetRowCount(row_count)) {
+		is_exact = false;
+		row_count = GetCompression(0) == FileCompressionType::UNCOMPRESSED
+		                ? CsvCardinalityEstimator::EstimateRows(*file_handle)
+		                : DConstants::INVALID_INDEX;
+		if (row_count == DConstants::INVALID_INDEX) {
+			// We cannot sample a pipe or a compressed file, so assume 5 bytes per column
+			row_count = file_handle->GetFileSize() / (column_names.size() * 5);
+		}
+	}
+	if (files.size() > 1) {
+		// Assume that the other files look like the first one, so that binding does not open all of them
+		row_count *= files.size();
+	}
+	// Only the rows in [row_offset, row_offset + row_limit) are returned
+	row_count = row_count > options.row_offset ? MinValue<idx_t>(row_count - options.row_offset, options.row_limit) : 0;
+	if (is_exact) {
+		return make_uniq<NodeStatistics>(row_count, row_count);
+	}
+	return make_uniq<NodeStatistics>(row_count);
+}
+
+CsvBlockIterator::CsvBlockIterator(shared_ptr<CsvBufferPool> buffer_pool_p, shared_ptr<FileHandle> file_handle_p,
+                                   idx_t buffer_size, idx_t first_block_size_p, const CsvDialect &dialect_p,
+                                   bool parallel_read, bool use_mmap,
+                                   idx_t read_ahead_blocks, shared_ptr<CsvLineIndex> line_index_p,
+                                   shared_ptr<CsvFrameIndex> frame_index_p, idx_t row_offset, idx_t row_limit,
+                                   shared_ptr<CsvZoneMap> zone_map_p, vector<CsvReaderFilter> zone_map_filters_p,
+                                   idx_t first_batch_index_p, idx_t start_offset, bool complete_rows_only_p)
+	: buffer_pool(std::move(buffer_pool_p)), file_handle(std::move(file_handle_p)), file_size(file_handle->GetFileSize()),
+	  current_file_pos(start_offset), buffer_size(buffer_size),
+	  first_block_size(MinValue<idx_t>(first_block_size_p, buffer_size)), next_block_size(first_block_size),
+	  dialect(dialect_p),
+	  parallel_read(parallel_read && file_handle->CanSeek()),
+	  line_index(std::move(line_index_p)), next_indexed_block(0), frame_index(std::move(frame_index_p)),
+	  next_frame_group(0), next_range(0), first_batch_index(first_batch_index_p), num_sequential_blocks(0),
+	  counts_rows(!line_index && (row_offset > 0 || row_limit != NumericLimits<idx_t>::Maximum())),
+	  row_offset(row_offset),
+	  row_end(row_limit < NumericLimits<idx_t>::Maximum() - row_offset ? row_offset + row_limit
+	                                                                  : NumericLimits<idx_t>::Maximum()),
+	  next_row(0), is_stream(!file_handle->CanSeek()), stream_finished(false),
+	  complete_rows_only(complete_rows_only_p), tail_finished(false), zone_map(std::move(zone_map_p)),
+	  zone_map_filters(std::move(zone_map_filters_p)) {
+	// The bytes of a frame-compressed file are not the rows, so it is never mapped
+	if (use_mmap && !frame_index) {
+		mapping = CsvMappedFile::TryMap(*file_handle);
+	}
+	if (line_index) {
+		CutIndexedBlocks(row_offset, row_limit);
+	}
+	if (frame_index) {
+		CutFrameGroups();
+		pending_ranges.resize(frame_groups.size() - 1);
+	}
+	if (!line_index && !frame_index && (mapping || this->parallel_read)) {
+		range_offsets = CutRanges(file_size, first_block_size, buffer_size);
+		pending_ranges.resize(range_offsets.size() - 1);
+	}
+	// Blocks cut by the line index always start outside quotes, but byte ranges and frame groups may not
+	if (dialect.HasQuotes() && !line_index) {
+		if (frame_index) {
+			quote_tracker = make_uniq<CsvQuoteTracker>(frame_groups.size() - 1);
+		} else if (mapping || this->parallel_read) {
+			quote_tracker = make_uniq<CsvQuoteTracker>(range_offsets.size() - 1);
+		}
+	}
+	if (is_stream) {
+		// A stream can only be decompressed by a single thread, so it runs ahead of the threads parsing its blocks
+		read_ahead_blocks = MaxValue<idx_t>(read_ahead_blocks, STREAM_READ_AHEAD_BLOCKS);
+	}
+	// A background reader serializes the reads, so it only runs ahead of a file read in order anyway. The threads
+	// reading a file in parallel read their own ranges, and hint the ranges claimed after theirs to the OS instead.
+	auto reads_in_order = is_stream || (!this->parallel_read && !mapping && !line_index && !frame_index);
+	if (read_ahead_blocks > 0 && !reads_in_order) {
+		prefetch_blocks = read_ahead_blocks;
+		if (!mapping) {
+			prefetcher = CsvFilePrefetcher::TryCreate(*file_handle);
+		}
+	}
+	// Reading ahead makes no sense for a file read in a single block
+	if (read_ahead_blocks > 0 && reads_in_order && (is_stream || file_size > first_block_size) &&
+	    CsvReadAhead::IsSupported()) {
+		read_ahead = make_uniq<CsvReadAhead>([this]() { return ReadNext(); }, read_ahead_blocks);
+	}
 };
 
+void CsvBlockIterator::PrefetchAfter(idx_t claimed_idx) {
+	if (prefetch_blocks == 0 || (!mapping && !prefetcher)) {
+		return;
+	}
+	auto end = MinValue<idx_t>(claimed_idx + 1 + prefetch_blocks, GetBatchCount());
+	// Each range is hinted once, by the thread moving the window past it
+	auto start = prefetched_until.load();
+	do {
+		if (start >= end) {
+			return;
+		}
+	} while (!prefetched_until.compare_exchange_weak(start, end));
+	for (auto i = MaxValue<idx_t>(start, claimed_idx + 1); i < end; i++) {
+		idx_t offset, nbytes;
+		if (line_index) {
+			offset = indexed_block_offsets[i];
+			nbytes = indexed_block_offsets[i + 1] - offset;
+		} else if (frame_index) {
+			auto &frames = frame_index->frames;
+			auto &last_frame = frames[frame_groups[i + 1] - 1];
+			offset = frames[frame_groups[i]].offset;
+			nbytes = last_frame.offset + last_frame.size - offset;
+		} else {
+			offset = range_offsets[i];
+			nbytes = range_offsets[i + 1] - offset;
+		}
+		if (mapping) {
+			mapping->WillNeed(offset, nbytes);
+		} else {
+			prefetcher->WillNeed(offset, nbytes);
+		}
+	}
+}
+
 unique_ptr<CsvBlock> CsvBlockIterator::Next() {
-	if (current_file_pos >= file_handle->GetFileSize()) {
+	if (read_ahead) {
+		return read_ahead->Next();
+	}
+	return ReadNext();
+}
+
+//! Counts the rows in a block that starts and ends at row boundaries. Empty lines are not rows, as in the readers.
+static idx_t CountRows(const char *data, idx_t size, const CsvDialect &dialect) {
+	idx_t row_count = 0;
+	bool in_quotes = false;
+	idx_t pos = 0;
+	while (pos < size) {
+		auto is_empty_line = data[pos] == '\n' || (data[pos] == '\r' && (pos + 1 == size || data[pos + 1] == '\n'));
+		if (!is_empty_line) {
+			row_count++;
+		}
+		pos = dialect.FindRowEnd(data, pos, size, in_quotes) + 1;
+	}
+	return row_count;
+}
+
+unique_ptr<CsvBlock> CsvBlockIterator::ReadNext() {
+	if (line_index) {
+		return NextIndexedBlock();
+	}
+	if (frame_index) {
+		return NextFrameGroup();
+	}
+	if (mapping) {
+		return NextMappedRange();
+	}
+	if (parallel_read) {
+		return NextRange();
+	}
+	while (next_row < row_end) {
+		auto block = is_stream ? NextStream() : NextSequential();
+		if (!block) {
+			return nullptr;
+		}
+		block->SetBatchIndex(first_batch_index + num_sequential_blocks++);
+		if (!counts_rows) {
+			return block;
+		}
+		// Without a line index, the rows before the range are skipped by counting them block by block
+		auto first_row = next_row;
+		next_row += CountRows(char_ptr_cast(block->GetData()), block->GetSize(), dialect);
+		if (next_row > row_offset) {
+			block->SetFirstRow(first_row);
+			return block;
+		}
+	}
+	// The rest of the file is past the requested rows
+	return nullptr;
+}
+
+// A block ends at its last row end, and the partial row after it is carried over to the front of the next block
+// instead of being read again. A row longer than the block grows the buffer until the row ends.
+unique_ptr<CsvBlock> CsvBlockIterator::NextSequential() {
+	if ((current_file_pos >= file_size && carry_over.empty()) || tail_finished) {
 		return nullptr;
 	}
+	auto read_size = MaxValue<idx_t>(NextBlockSize(), carry_over.size() * 2);
+	auto buffer = make_uniq<CsvFileBuffer>(buffer_pool, read_size);
+	idx_t read_bytes = carry_over.size();
+	if (read_bytes > 0) {
+		memcpy(buffer->internal_buffer, carry_over.data(), read_bytes);
+		carry_over.clear();
+	}
+	while (true) {
+		auto nbytes = MinValue<idx_t>(read_size - read_bytes, file_size - current_file_pos);
+		if (nbytes > 0) {
+			buffer->Read(*file_handle, current_file_pos, read_bytes, nbytes);
+			current_file_pos += nbytes;
+			read_bytes += nbytes;
+		}
+		auto buffer_ptr = char_ptr_cast(buffer->internal_buffer);
+		if (current_file_pos >= file_size) {
+			if (complete_rows_only) {
+				// The row after the last newline is left for the next scan, which reads it once it is complete
+				auto row_end = dialect.FindLastRowEnd(buffer_ptr, read_bytes);
+				current_file_pos -= read_bytes - row_end;
+				read_bytes = row_end;
+				tail_finished = true;
+			}
+			// The last row in the file may not have a trailing newline
+			return read_bytes > 0 ? make_uniq<CsvBlock>(std::move(buffer), read_bytes) : nullptr;
+		}
+		auto row_end = dialect.FindLastRowEnd(buffer_ptr, read_bytes);
+		if (row_end > 0) {
+			carry_over.assign(buffer_ptr + row_end, buffer_ptr + read_bytes);
+			return make_uniq<CsvBlock>(std::move(buffer), row_end);
+		}
+		// A row longer than the buffer, so grow the buffer until the row ends
+		read_size *= 2;
+		buffer->Resize(read_size, read_bytes);
+	}
+}
 
-	auto buffer = make_uniq<CsvFileBuffer>(allocator, buffer_size);
-	buffer->Read(*file_handle, current_file_pos);
+// A stream cannot be read again, so a block ends at its last row end and the partial row after it is
+// carried over to the front of the next block.
+unique_ptr<CsvBlock> CsvBlockIterator::NextStream() {
+	if (stream_finished) {
+		return nullptr;
+	}
+	auto read_size = MaxValue<idx_t>(NextBlockSize(), carry_over.size() * 2);
+	auto buffer = make_uniq<CsvFileBuffer>(buffer_pool, read_size);
+	idx_t read_bytes = carry_over.size();
+	if (read_bytes > 0) {
+		memcpy(buffer->internal_buffer, carry_over.data(), read_bytes);
+		carry_over.clear();
+	}
+	while (true) {
+		while (read_bytes < read_size) {
+			auto nbytes = file_handle->Read(buffer->internal_buffer + read_bytes, read_size - read_bytes);
+			if (nbytes <= 0) {
+				stream_finished = true;
+				break;
+			}
+			read_bytes += NumericCast<idx_t>(nbytes);
+		}
+		// The position in the compressed file, which is what `file_size` measures
+		current_file_pos = file_handle->GetProgress();
+		if (stream_finished) {
+			// The last row in the file may not have a trailing newline
+			return read_bytes > 0 ? make_uniq<CsvBlock>(std::move(buffer), read_bytes) : nullptr;
+		}
+		// The carried-over bytes have no row end, but the quotes in them are needed to find the next one
+		auto buffer_ptr = char_ptr_cast(buffer->internal_buffer);
+		auto row_end = dialect.FindLastRowEnd(buffer_ptr, read_bytes);
+		if (row_end > 0) {
+			carry_over.assign(buffer_ptr + row_end, buffer_ptr + read_bytes);
+			return make_uniq<CsvBlock>(std::move(buffer), row_end);
+		}
+		// A row longer than the buffer, so grow the buffer until the row ends
+		read_size *= 2;
+		buffer->Resize(read_size, read_bytes);
+	}
+}
 
-	if (current_file_pos + buffer_size >= file_handle->GetFileSize()) {
-		auto read_bytes = file_handle->GetFileSize() - current_file_pos;
-		current_file_pos += read_bytes;
-		return make_uniq<CsvBlock>(std::move(buffer), read_bytes);
+bool CsvBlockIterator::ResolveQuoteState(idx_t range_idx, unique_ptr<PendingRange> pending, const char *data,
+                                         CsvQuoteState &start_state) {
+	pending->quote_transition =
+	    dialect.GetQuoteTransition(data + pending->range_start, pending->range_end - pending->range_start);
+	auto quote_transition = pending->quote_transition;
+	if (zone_map) {
+		// A block skipped by a later scan still has to pass on the quote state
+		zone_map->SetQuoteTransition(range_idx, quote_transition);
+	}
+	// Stored before the transition is published, so that the thread taking the range once it is parked finds it
+	pending_ranges[range_idx] = std::move(pending);
+	if (!quote_tracker) {
+		start_state = CsvQuoteState::OUTSIDE;
+		return true;
 	}
+	return quote_tracker->Resolve(range_idx, quote_transition, start_state);
+}
 
-	// Rewind the byte read position to the last newline one
-	auto buffer_ptr = char_ptr_cast(buffer->internal_buffer);
-	auto read_bytes = buffer_size;
-	while (read_bytes > 0) {
-		if (buffer_ptr[read_bytes - 1] != '\n') {
-			read_bytes--;
-		} else {
+bool CsvBlockIterator::TakeResolvedRange(idx_t &range_idx, CsvQuoteState &start_state) {
+	return quote_tracker && quote_tracker->TakeResolved(range_idx, start_state);
+}
+
+idx_t CsvBlockIterator::FindRowStart(const char *data, idx_t range_start, idx_t range_end,
+                                     CsvQuoteState start_state) const {
+	D_ASSERT(range_start > 0);
+	auto in_quotes = start_state != CsvQuoteState::OUTSIDE;
+	if (IsRowEnd(data, range_start, in_quotes)) {
+		return range_start;
+	}
+	// An escaped first byte cannot end a quoted field
+	auto search_pos = start_state == CsvQuoteState::ESCAPED ? range_start + 1 : range_start;
+	auto row_end = dialect.FindRowEnd(data, search_pos, range_end, in_quotes);
+	return MinValue<idx_t>(row_end + 1, range_end);
+}
+
+void CsvBlockIterator::CancelQuoteTracker() {
+	if (quote_tracker) {
+		quote_tracker->Cancel();
+	}
+}
+
+// A byte range [range_start, range_end) owns the rows starting in it. So, a thread skips the row
+// that the previous range owns and reads past the range end until its last row is terminated.
+// Whether the range starts in a quoted field follows from the quote transitions of the ranges before it, which the
+// threads reading them publish right after the read. A range whose start is not known yet is parked, and the thread
+// claims the next range instead of waiting.
+unique_ptr<CsvBlock> CsvBlockIterator::NextRange() {
+	while (true) {
+		idx_t block_index;
+		CsvQuoteState start_state;
+		if (!TakeResolvedRange(block_index, start_state)) {
+			block_index = next_range++;
+			if (block_index + 1 >= range_offsets.size()) {
+				return nullptr;
+			}
+			PrefetchAfter(block_index);
+			auto range_start = range_offsets[block_index];
+			auto range_end = range_offsets[block_index + 1];
+			current_file_pos = range_end;
+			CsvQuoteTransition quote_transition;
+			if (zone_map && zone_map->CanSkip(block_index, zone_map_filters, quote_transition)) {
+				num_skipped_blocks++;
+				if (quote_tracker) {
+					quote_tracker->SetTransition(block_index, quote_transition);
+				}
+				continue;
+			}
+
+			// Read a byte just before the range to check if the range starts on a row boundary
+			auto pending = make_uniq<PendingRange>();
+			pending->read_start = range_start == 0 ? range_start : range_start - 1;
+			pending->range_start = range_start - pending->read_start;
+			pending->range_end = range_end - pending->read_start;
+			pending->read_bytes =
+			    MinValue<idx_t>(pending->range_end + CSV_LOOKAHEAD_SIZE, file_size - pending->read_start);
+			pending->buffer = make_uniq<CsvFileBuffer>(buffer_pool, pending->read_bytes);
+			try {
+				pending->buffer->Read(*file_handle, pending->read_start, 0, pending->read_bytes);
+			} catch (std::exception &) {
+				// The ranges after this one can never be resolved
+				CancelQuoteTracker();
+				throw;
+			}
+			auto range_ptr = char_ptr_cast(pending->buffer->internal_buffer);
+			if (!ResolveQuoteState(block_index, std::move(pending), range_ptr, start_state)) {
+				continue;
+			}
+		}
+		auto block = FinishRange(block_index, start_state);
+		if (block) {
+			return block;
+		}
+	}
+}
+
+unique_ptr<CsvBlock> CsvBlockIterator::FinishRange(idx_t block_index, CsvQuoteState start_state) {
+	auto pending = std::move(pending_ranges[block_index]);
+	auto &buffer = pending->buffer;
+	auto read_start = pending->read_start;
+	auto range_end = pending->range_end;
+	auto read_bytes = pending->read_bytes;
+
+	// The buffer is only resized after the row start is resolved
+	auto range_ptr = char_ptr_cast(buffer->internal_buffer);
+	idx_t row_start = 0;
+	if (read_start + pending->range_start > 0) {
+		row_start = FindRowStart(range_ptr, pending->range_start, range_end, start_state);
+		if (row_start >= range_end) {
+			// No row starts in this range
+			if (zone_map) {
+				zone_map->SetEmptyBlock(block_index);
+			}
+			return nullptr;
+		}
+	}
+
+	// The last row in this range ends at the first newline outside quotes at or after the last byte of the range
+	auto end_state = pending->quote_transition.Apply(start_state);
+	auto end_in_quotes = end_state != CsvQuoteState::OUTSIDE;
+	auto row_end = IsRowEnd(range_ptr, range_end, end_in_quotes) ? range_end : DConstants::INVALID_INDEX;
+	auto search_pos = end_state == CsvQuoteState::ESCAPED ? range_end + 1 : range_end;
+	while (row_end == DConstants::INVALID_INDEX) {
+		auto buffer_ptr = char_ptr_cast(buffer->internal_buffer);
+		auto pos = dialect.FindRowEnd(buffer_ptr, search_pos, read_bytes, end_in_quotes);
+		if (pos < read_bytes) {
+			row_end = pos + 1;
 			break;
 		}
+		if (read_start + read_bytes >= file_size) {
+			// The last row in the file may not have a trailing newline
+			row_end = read_bytes;
+			break;
+		}
+		auto nbytes = MinValue<idx_t>(MaxValue<idx_t>(read_bytes, CSV_LOOKAHEAD_SIZE),
+		                              file_size - read_start - read_bytes);
+		buffer->Resize(read_bytes + nbytes, read_bytes);
+		buffer->Read(*file_handle, read_start + read_bytes, read_bytes, nbytes);
+		// Past the end if the bytes read end with an escape character, whose escaped byte is skipped
+		search_pos = pos;
+		read_bytes += nbytes;
+	}
+
+	auto block = make_uniq<CsvBlock>(std::move(buffer), row_start, row_end - row_start);
+	block->SetZoneMap(zone_map, block_index);
+	block->SetBatchIndex(first_batch_index + block_index);
+	return block;
+}
+
+unique_ptr<CsvBlock> CsvBlockIterator::NextMappedRange() {
+	auto data = char_ptr_cast(mapping->data);
+	while (true) {
+		idx_t block_index;
+		CsvQuoteState start_state;
+		if (!TakeResolvedRange(block_index, start_state)) {
+			block_index = next_range++;
+			if (block_index + 1 >= range_offsets.size()) {
+				return nullptr;
+			}
+			PrefetchAfter(block_index);
+			auto range_start = range_offsets[block_index];
+			auto range_end = range_offsets[block_index + 1];
+			current_file_pos = range_end;
+			CsvQuoteTransition quote_transition;
+			if (zone_map && zone_map->CanSkip(block_index, zone_map_filters, quote_transition)) {
+				num_skipped_blocks++;
+				if (quote_tracker) {
+					quote_tracker->SetTransition(block_index, quote_transition);
+				}
+				continue;
+			}
+			auto pending = make_uniq<PendingRange>();
+			pending->range_start = range_start;
+			pending->range_end = range_end;
+			if (!ResolveQuoteState(block_index, std::move(pending), data, start_state)) {
+				continue;
+			}
+		}
+		auto block = FinishMappedRange(block_index, start_state);
+		if (block) {
+			return block;
+		}
+	}
+}
+
+unique_ptr<CsvBlock> CsvBlockIterator::FinishMappedRange(idx_t block_index, CsvQuoteState start_state) {
+	auto pending = std::move(pending_ranges[block_index]);
+	auto data = char_ptr_cast(mapping->data);
+	auto range_start = pending->range_start;
+	auto range_end = pending->range_end;
+	auto row_start = range_start;
+	if (range_start > 0) {
+		row_start = FindRowStart(data, range_start, range_end, start_state);
+		if (row_start >= range_end) {
+			// No row starts in this range
+			if (zone_map) {
+				zone_map->SetEmptyBlock(block_index);
+			}
+			return nullptr;
+		}
+	}
+	auto end_state = pending->quote_transition.Apply(start_state);
+	auto end_in_quotes = end_state != CsvQuoteState::OUTSIDE;
+	auto row_end = range_end;
+	if (!IsRowEnd(data, range_end, end_in_quotes)) {
+		auto search_pos = end_state == CsvQuoteState::ESCAPED ? range_end + 1 : range_end;
+		row_end = MinValue<idx_t>(dialect.FindRowEnd(data, search_pos, file_size, end_in_quotes) + 1, file_size);
+	}
+
+	mapping->WillNeed(row_start, row_end - row_start);
+	auto block = make_uniq<CsvBlock>(mapping, row_start, row_end - row_start);
+	block->SetZoneMap(zone_map, block_index);
+	block->SetBatchIndex(first_batch_index + block_index);
+	return block;
+}
+
+vector<idx_t> CsvBlockIterator::CutRanges(idx_t file_size, idx_t first_block_size, idx_t block_size) {
+	vector<idx_t> offsets {0};
+	auto range_size = first_block_size;
+	while (offsets.back() < file_size) {
+		offsets.push_back(MinValue<idx_t>(offsets.back() + range_size, file_size));
+		range_size = MinValue<idx_t>(range_size * 2, block_size);
+	}
+	return offsets;
+}
+
+idx_t CsvBlockIterator::GetTargetBlockSize(idx_t file_size, idx_t num_threads, idx_t max_block_size) {
+	auto block_size = file_size / MaxValue<idx_t>(num_threads * BLOCKS_PER_THREAD, 1);
+	return MinValue<idx_t>(MaxValue<idx_t>(block_size, MIN_BLOCK_SIZE), max_block_size);
+}
+
+void CsvBlockIterator::CutIndexedBlocks(idx_t row_offset, idx_t row_limit) {
+	auto &row_offsets = line_index->row_offsets;
+	auto interval = line_index->interval;
+	auto end_row = line_index->row_count;
+	if (row_offset < end_row && row_limit < end_row - row_offset) {
+		end_row = row_offset + row_limit;
+	}
+	if (row_offset >= end_row) {
+		return;
+	}
+	// Blocks start at indexed rows, so readers skip the rows before `row_offset` in the first block
+	auto first_entry = row_offset / interval;
+	auto end_entry = (end_row + interval - 1) / interval;
+	auto block_size = first_block_size;
+	for (auto entry = first_entry; entry < end_entry; entry++) {
+		if (entry == first_entry || row_offsets[entry] - indexed_block_offsets.back() >= block_size) {
+			if (entry != first_entry) {
+				block_size = MinValue<idx_t>(block_size * 2, buffer_size);
+			}
+			indexed_block_offsets.push_back(row_offsets[entry]);
+			indexed_block_rows.push_back(entry * interval);
+		}
 	}
+	indexed_block_offsets.push_back(end_entry < row_offsets.size() ? row_offsets[end_entry] : file_size);
+}
 
-	if (read_bytes == 0) {
-		throw IOException("Could not read CSV block: too long single line in file");
+unique_ptr<CsvBlock> CsvBlockIterator::NextIndexedBlock() {
+	auto block_idx = next_indexed_block++;
+	if (block_idx + 1 >= indexed_block_offsets.size()) {
+		return nullptr;
 	}
+	PrefetchAfter(block_idx);
+	auto block_start = indexed_block_offsets[block_idx];
+	auto block_size = indexed_block_offsets[block_idx + 1] - block_start;
+	current_file_pos = block_start + block_size;
 
-	current_file_pos += read_bytes;
+	unique_ptr<CsvBlock> block;
+	if (mapping) {
+		mapping->WillNeed(block_start, block_size);
+		block = make_uniq<CsvBlock>(mapping, block_start, block_size);
+	} else {
+		auto buffer = make_uniq<CsvFileBuffer>(buffer_pool, block_size);
+		buffer->Read(*file_handle, block_start, 0, block_size);
+		block = make_uniq<CsvBlock>(std::move(buffer), block_size);
+	}
+	block->SetFirstRow(indexed_block_rows[block_idx]);
+	block->SetBatchIndex(first_batch_index + block_idx);
+	return block;
+}
 
-	return make_uniq<CsvBlock>(std::move(buffer), read_bytes);
+void CsvBlockIterator::CutFrameGroups() {
+	auto &frames = frame_index->frames;
+	idx_t group_size = 0;
+	auto block_size = first_block_size;
+	for (idx_t i = 0; i < frames.size(); i++) {
+		if (i == 0 || group_size >= block_size) {
+			if (i > 0) {
+				block_size = MinValue<idx_t>(block_size * 2, buffer_size);
+			}
+			frame_groups.push_back(i);
+			group_size = 0;
+		}
+		group_size += frames[i].decompressed_size;
+	}
+	frame_groups.push_back(frames.size());
+}
+
+// A frame group owns the rows starting in its decompressed bytes, like a byte range in NextRange. So, a thread
+// also decompresses the frame before the group to check if the group starts on a row boundary, and decompresses
+// the frames after the group until its last row is terminated.
+unique_ptr<CsvBlock> CsvBlockIterator::NextFrameGroup() {
+	auto &frames = frame_index->frames;
+	while (true) {
+		idx_t group_idx;
+		CsvQuoteState start_state;
+		if (!TakeResolvedRange(group_idx, start_state)) {
+			group_idx = next_frame_group++;
+			if (group_idx + 1 >= frame_groups.size()) {
+				return nullptr;
+			}
+			PrefetchAfter(group_idx);
+			auto first_frame = frame_groups[group_idx];
+			auto end_frame = frame_groups[group_idx + 1];
+			current_file_pos = frames[end_frame - 1].offset + frames[end_frame - 1].size;
+
+			// Empty frames (e.g., the BGZF end-of-file marker) have no last byte, so look for a non-empty one
+			auto read_frame = first_frame;
+			while (read_frame > 0 && (read_frame == first_frame || frames[read_frame].decompressed_size == 0)) {
+				read_frame--;
+			}
+			auto pending = make_uniq<PendingRange>();
+			for (auto i = read_frame; i < end_frame; i++) {
+				if (i == first_frame) {
+					pending->range_start = pending->read_bytes;
+				}
+				pending->read_bytes += frames[i].decompressed_size;
+			}
+			pending->range_end = pending->read_bytes;
+			pending->next_frame = end_frame;
+			if (pending->range_start == pending->read_bytes) {
+				// The frames in this group are empty
+				if (quote_tracker) {
+					quote_tracker->SetTransition(group_idx, CsvQuoteTransition());
+				}
+				continue;
+			}
+			pending->buffer = make_uniq<CsvFileBuffer>(buffer_pool, pending->read_bytes);
+			try {
+				idx_t offset = 0;
+				for (auto i = read_frame; i < end_frame; i++) {
+					frame_index->Decompress(*file_handle, i, pending->buffer->internal_buffer + offset);
+					offset += frames[i].decompressed_size;
+				}
+			} catch (std::exception &) {
+				// The groups after this one can never be resolved
+				CancelQuoteTracker();
+				throw;
+			}
+			auto group_ptr = char_ptr_cast(pending->buffer->internal_buffer);
+			if (!ResolveQuoteState(group_idx, std::move(pending), group_ptr, start_state)) {
+				continue;
+			}
+		}
+		auto block = FinishFrameGroup(group_idx, start_state);
+		if (block) {
+			return block;
+		}
+	}
+}
+
+unique_ptr<CsvBlock> CsvBlockIterator::FinishFrameGroup(idx_t group_idx, CsvQuoteState start_state) {
+	auto &frames = frame_index->frames;
+	auto pending = std::move(pending_ranges[group_idx]);
+	auto &buffer = pending->buffer;
+	auto read_bytes = pending->read_bytes;
+
+	// The buffer is only resized after the row start is resolved
+	auto group_ptr = char_ptr_cast(buffer->internal_buffer);
+	idx_t row_start = 0;
+	if (pending->range_start > 0) {
+		row_start = FindRowStart(group_ptr, pending->range_start, read_bytes, start_state);
+		if (row_start >= read_bytes) {
+			// No row starts in this group
+			return nullptr;
+		}
+	}
+
+	// The last row in this group ends at the first newline outside quotes at or after the last byte of the group
+	auto end_state = pending->quote_transition.Apply(start_state);
+	auto end_in_quotes = end_state != CsvQuoteState::OUTSIDE;
+	auto row_end = IsRowEnd(group_ptr, read_bytes, end_in_quotes) ? read_bytes : DConstants::INVALID_INDEX;
+	auto search_pos = end_state == CsvQuoteState::ESCAPED ? read_bytes + 1 : read_bytes;
+	auto next_frame = pending->next_frame;
+	while (row_end == DConstants::INVALID_INDEX) {
+		auto buffer_ptr = char_ptr_cast(buffer->internal_buffer);
+		auto pos = dialect.FindRowEnd(buffer_ptr, search_pos, read_bytes, end_in_quotes);
+		if (pos < read_bytes) {
+			row_end = pos + 1;
+			break;
+		}
+		if (next_frame >= frames.size()) {
+			// The last row in the file may not have a trailing newline
+			row_end = read_bytes;
+			break;
+		}
+		auto nbytes = frames[next_frame].decompressed_size;
+		buffer->Resize(read_bytes + nbytes, read_bytes);
+		frame_index->Decompress(*file_handle, next_frame++, buffer->internal_buffer + read_bytes);
+		// Past the end if the bytes decompressed end with an escape character, whose escaped byte is skipped
+		search_pos = pos;
+		read_bytes += nbytes;
+	}
+	auto block = make_uniq<CsvBlock>(std::move(buffer), row_start, row_end - row_start);
+	block->SetBatchIndex(first_batch_index + group_idx);
+	return block;
 }
 
 CsvReader::CsvReader(idx_t idx, const vector<string> &column_names_p, const vector<LogicalType> &column_types_p,
+                     const vector<CsvColumnConverter> &converters_p, const CsvDialect &dialect_p,
+                     const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters_p, idx_t row_offset_p,
+                     idx_t row_limit, bool columnar_p, bool simd_p, CsvScanStats &stats_p,
                      unique_ptr<CsvBlock> block_p)
-	: reader_idx(idx), column_names(column_names_p), column_types(column_types_p),
-	  block(std::move(block_p)), current_buffer_pos(0) {
+	: reader_idx(idx), column_names(column_names_p), column_types(column_types_p), converters(converters_p),
+	  dialect(dialect_p), projection_map(column_types_p.size(), DConstants::INVALID_INDEX), num_needed_columns(0),
+	  columnar(columnar_p), simd(simd_p), block(std::move(block_p)), block_vector_buffer(make_buffer<CsvBlockVectorBuffer>(block)),
+	  current_buffer_pos(0), row_offset(row_offset_p),
+	  row_end(row_limit < NumericLimits<idx_t>::Maximum() - row_offset_p ? row_offset_p + row_limit
+	                                                                    : NumericLimits<idx_t>::Maximum()),
+	  current_row(block->GetFirstRow()), stats(stats_p) {
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		// Nothing to read for the row id column (e.g., `SELECT count(*)`)
+		if (column_ids[i] == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		projection_map[column_ids[i]] = i;
+		num_needed_columns = MaxValue<idx_t>(num_needed_columns, column_ids[i] + 1);
+	}
+	// Statistics collection tokenizes all the columns
+	field_starts.resize(column_types.size());
+	field_lengths.resize(column_types.size());
+	filters = GetReaderFilters(column_ids, column_types, filters_p);
+	unordered_set<idx_t> filter_columns;
+	for (auto &filter : filters) {
+		filter_columns.insert(filter.column_idx);
+	}
+	for (idx_t j = 0; j < num_needed_columns; j++) {
+		if (projection_map[j] != DConstants::INVALID_INDEX && filter_columns.count(j) == 0) {
+			materialized_columns.push_back(j);
+		}
+	}
+	if (columnar) {
+		column_field_starts.resize(num_needed_columns);
+		column_field_lengths.resize(num_needed_columns);
+		for (auto &filter : filters) {
+			tokenized_columns.push_back(filter.column_idx);
+		}
+		tokenized_columns.insert(tokenized_columns.end(), materialized_columns.begin(), materialized_columns.end());
+		for (auto column_idx : tokenized_columns) {
+			column_field_starts[column_idx].resize(STANDARD_VECTOR_SIZE);
+			column_field_lengths[column_idx].resize(STANDARD_VECTOR_SIZE);
+		}
+	}
+	BuildStructuralIndex();
+	StartStatistics();
 }
 
-inline idx_t FindNextTargetChar(const char *data, idx_t len, char target) {
-	idx_t i = 0;
-	while (i < len && data[i] != target) {
-		i++;
+idx_t CsvReader::TokenizeRow(const char *data_ptr, idx_t data_size, idx_t num_columns) {
+	auto ncols = column_types.size();
+	for (idx_t j = 0; j < num_columns; j++) {
+		// The last column takes all the remaining fields in the row
+		auto len = j == ncols - 1 ? structural_index.FindNextTargetChar(data_ptr, current_buffer_pos, '\n')
+		                          : structural_index.NextStructuralChar(current_buffer_pos) - current_buffer_pos;
+		field_starts[j] = current_buffer_pos;
+		field_lengths[j] = len;
+		auto field_end = current_buffer_pos + len;
+		current_buffer_pos = field_end + 1;
+		if (field_end >= data_size || data_ptr[field_end] == '\n') {
+			// The CR of a CRLF line ending is not a part of the last field
+			if (len > 0 && data_ptr[field_end - 1] == '\r') {
+				field_lengths[j]--;
+			}
+			return j + 1;
+		}
+	}
+	// We have read all the needed columns, so jump to the next row
+	current_buffer_pos += structural_index.FindNextTargetChar(data_ptr, current_buffer_pos, '\n') + 1;
+	return num_columns;
+}
+
+void CsvReader::ConvertColumn(const char *data_ptr, idx_t column_idx, idx_t num_fields, Vector &out_vec,
+                              idx_t row) {
+	// A row rejected by filters can leave a NULL in this slot, so the validity is always overwritten.
+	// Missing (the row has fewer fields than the columns), empty, or malformed values are read as NULL.
+	auto is_valid = column_idx < num_fields;
+	if (is_valid) {
+		auto field_ptr = data_ptr + field_starts[column_idx];
+		is_valid = ConvertField(converters[column_idx], field_ptr, field_lengths[column_idx], out_vec, row);
+	}
+	FlatVector::SetNull(out_vec, row, !is_valid);
+}
+
+bool CsvReader::ConvertField(const CsvColumnConverter &converter, const char *field_ptr, idx_t len, Vector &out_vec,
+                             idx_t row) {
+	if (!structural_index.HasQuotes() || len == 0 || field_ptr[0] != dialect.quote) {
+		return converter.Convert(field_ptr, len, out_vec, row);
+	}
+	// Strip the quotes around the field; anything between the closing quote and the delimiter is kept
+	auto has_closing_quote = len > 1 && field_ptr[len - 1] == dialect.quote;
+	field_ptr++;
+	len -= has_closing_quote ? 2 : 1;
+	auto has_escapes = memchr(field_ptr, dialect.quote, len) ||
+	                   (dialect.escape != dialect.quote && memchr(field_ptr, dialect.escape, len));
+	if (!has_escapes) {
+		return converter.Convert(field_ptr, len, out_vec, row);
+	}
+	unquoted_field.clear();
+	for (idx_t i = 0; i < len; i++) {
+		if (field_ptr[i] == dialect.escape && i + 1 < len &&
+		    (field_ptr[i + 1] == dialect.quote || field_ptr[i + 1] == dialect.escape)) {
+			i++;
+		}
+		unquoted_field.push_back(field_ptr[i]);
+	}
+	if (!converter.Convert(unquoted_field.data(), unquoted_field.size(), out_vec, row)) {
+		return false;
+	}
+	if (out_vec.GetType().id() == LogicalTypeId::VARCHAR) {
+		// The value points into the scratch string, so it is copied into the vector
+		auto &value = FlatVector::GetData<string_t>(out_vec)[row];
+		value = StringVector::AddString(out_vec, value);
 	}
-	return i;
+	return true;
 }
 
-void CsvReader::Flush(DataChunk &chunk) {
+void CsvReader::StartStatistics() {
+	auto &zone_map = block->GetZoneMap();
+	// Zone map blocks are cut by bytes, so their rows are never numbered (and cut short by a row range)
+	collect_statistics =
+	    zone_map && current_row == DConstants::INVALID_INDEX && !zone_map->HasBlock(block->GetBlockIndex());
+	if (!collect_statistics) {
+		return;
+	}
+	block_statistics.clear();
+	for (auto &type : column_types) {
+		block_statistics.push_back(CsvZoneMap::CreateEmptyStatistics(type));
+	}
+	block_null_counts.assign(column_types.size(), 0);
+	block_row_count = 0;
+	// Fresh vectors, so that unescaped strings of the previous blocks do not pile up in them
+	statistics_values.clear();
+	for (auto &type : column_types) {
+		statistics_values.emplace_back(type, 1);
+	}
+}
+
+void CsvReader::CollectRowStatistics(const char *data_ptr, idx_t num_fields, DataChunk &chunk, idx_t row) {
+	for (idx_t j = 0; j < column_types.size(); j++) {
+		auto is_projected = projection_map[j] != DConstants::INVALID_INDEX;
+		auto &out_vec = is_projected ? chunk.data[projection_map[j]] : statistics_values[j];
+		auto out_row = is_projected ? row : 0;
+		ConvertColumn(data_ptr, j, num_fields, out_vec, out_row);
+		auto is_valid = !FlatVector::IsNull(out_vec, out_row);
+		CsvZoneMap::UpdateStatistics(block_statistics[j], out_vec, out_row, is_valid);
+		block_null_counts[j] += !is_valid;
+	}
+	block_row_count++;
+}
+
+void CsvReader::FinishStatistics() {
+	if (!collect_statistics || current_buffer_pos < block->GetSize()) {
+		return;
+	}
+	block->GetZoneMap()->SetBlock(block->GetBlockIndex(), std::move(block_statistics), std::move(block_null_counts),
+	                              block_row_count);
+	collect_statistics = false;
+}
+
+void CsvReader::FlushRows(DataChunk &chunk) {
 	auto data_ptr = char_ptr_cast(block->GetData());
 	auto data_size = block->GetSize();
 	if (current_buffer_pos >= data_size) {
+		FinishStatistics();
 		return;
 	}
+	for (auto &out_vec : chunk.data) {
+		if (out_vec.GetType().id() == LogicalTypeId::VARCHAR) {
+			StringVector::AddBuffer(out_vec, block_vector_buffer);
+		}
+	}
 
-	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
-		for (idx_t j = 0; j < column_types.size(); j++) {
-			auto next_sep = j == column_types.size() - 1 ? '\n' : ',';
-			auto len = FindNextTargetChar(data_ptr + current_buffer_pos, data_size - current_buffer_pos, next_sep);
-			if (len == 0) {
-				// If the CSV parsing process is in the middle, set NULL to the remaining columns
-				// and increase the number of rows.
-				if (j != 0) {
-					// TODO: handle left empty fields
-					chunk.SetCardinality(i + 1);
-				}
-				return;
-			}
-
-			auto &out_vec = chunk.data[j];
-
-			switch (column_types[j].id()) {
-			case LogicalTypeId::VARCHAR: {
-				auto str = StringVector::AddString(out_vec, data_ptr + current_buffer_pos, len);
-				FlatVector::GetData<string_t>(out_vec)[i] = str;
+	idx_t i = 0;
+	while (i < STANDARD_VECTOR_SIZE && current_buffer_pos < data_size) {
+		if (SkipEmptyLine(data_ptr, data_size)) {
+			continue;
+		}
+		if (current_row != DConstants::INVALID_INDEX) {
+			auto row = current_row++;
+			if (row >= row_end) {
+				// The rest of the block is past the requested rows
+				current_buffer_pos = data_size;
 				break;
 			}
-
-			case LogicalTypeId::BIGINT: {
-				auto iv = std::stoll(string(data_ptr + current_buffer_pos, len));
-				FlatVector::GetData<int64_t>(out_vec)[i] = iv;
-				break;
+			if (row < row_offset) {
+				current_buffer_pos += structural_index.FindNextTargetChar(data_ptr, current_buffer_pos, '\n') + 1;
+				continue;
 			}
+		}
+		auto num_columns = collect_statistics ? column_types.size() : num_needed_columns;
+		auto num_fields = TokenizeRow(data_ptr, data_size, num_columns);
+		num_parsed_rows++;
+		if (collect_statistics) {
+			CollectRowStatistics(data_ptr, num_fields, chunk, i);
+		}
 
-			case LogicalTypeId::DOUBLE: {
-				auto dv = std::stod(string(data_ptr + current_buffer_pos, len));
-				FlatVector::GetData<double>(out_vec)[i] = dv;
+		// Filter columns are converted and evaluated first, so that the other columns are
+		// only materialized for the rows passing all the filters.
+		bool qualified = true;
+		for (auto &filter : filters) {
+			auto &out_vec = chunk.data[filter.output_idx];
+			if (!collect_statistics) {
+				ConvertColumn(data_ptr, filter.column_idx, num_fields, out_vec, i);
+			}
+			if (!CsvFilter::Evaluate(filter.Get(), out_vec, i)) {
+				qualified = false;
 				break;
 			}
-
-			default:
-				throw InternalException("Unsupported Type %s", column_types[j].ToString());
+		}
+		if (!qualified) {
+			continue;
+		}
+		if (!collect_statistics) {
+			for (auto column_idx : materialized_columns) {
+				ConvertColumn(data_ptr, column_idx, num_fields, chunk.data[projection_map[column_idx]], i);
 			}
+		}
+		i++;
+	}
+	chunk.SetCardinality(i);
+	FinishStatistics();
+}
+
+void CsvReader::FlushColumns(DataChunk &chunk) {
+	auto data_ptr = char_ptr_cast(block->GetData());
+	auto data_size = block->GetSize();
+	if (current_buffer_pos >= data_size) {
+		return;
+	}
+	for (auto &out_vec : chunk.data) {
+		if (out_vec.GetType().id() == LogicalTypeId::VARCHAR) {
+			StringVector::AddBuffer(out_vec, block_vector_buffer);
+		}
+	}
 
-			current_buffer_pos += len + 1;
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t num_rows;
+	idx_t count;
+	idx_t tokenized;
+	// A batch of rows that all fail the filters does not end the block, so move on to the next batch until some rows
+	// pass or the block runs out
+	while (true) {
+		// Phase 1: tokenize the rows into the field matrix
+		auto start = CsvScanStats::Now();
+		num_rows = 0;
+		while (num_rows < STANDARD_VECTOR_SIZE && current_buffer_pos < data_size) {
+			if (SkipEmptyLine(data_ptr, data_size)) {
+				continue;
+			}
+			if (current_row != DConstants::INVALID_INDEX) {
+				auto row = current_row++;
+				if (row >= row_end) {
+					// The rest of the block is past the requested rows
+					current_buffer_pos = data_size;
+					break;
+				}
+				if (row < row_offset) {
+					current_buffer_pos += structural_index.FindNextTargetChar(data_ptr, current_buffer_pos, '\n') + 1;
+					continue;
+				}
+			}
+			auto num_fields = TokenizeRow(data_ptr, data_size, num_needed_columns);
+			num_parsed_rows++;
+			for (auto column_idx : tokenized_columns) {
+				column_field_starts[column_idx][num_rows] = field_starts[column_idx];
+				column_field_lengths[column_idx][num_rows] = column_idx < num_fields ? field_lengths[column_idx] : 0;
+			}
+			num_rows++;
 		}
 
-		chunk.SetCardinality(i + 1);
+		tokenized = CsvScanStats::Now();
+		stats.Add(CsvScanCounter::TOKENIZE_TIME, tokenized - start);
+
+		// Phase 2: convert the filter columns and narrow down the rows by their filters, and then convert the other
+		// columns only for the rows passing all the filters. Values are converted at the positions of their rows.
+		for (idx_t i = 0; i < num_rows; i++) {
+			sel.set_index(i, i);
+		}
+		count = num_rows;
+		for (auto &filter : filters) {
+			auto column_idx = filter.column_idx;
+			auto &out_vec = chunk.data[filter.output_idx];
+			converters[column_idx].ConvertColumn(data_ptr, column_field_starts[column_idx].data(),
+			                                     column_field_lengths[column_idx].data(), sel, count, out_vec);
+			idx_t qualified_count = 0;
+			for (idx_t i = 0; i < count; i++) {
+				auto row = sel.get_index(i);
+				if (CsvFilter::Evaluate(filter.Get(), out_vec, row)) {
+					sel.set_index(qualified_count++, row);
+				}
+			}
+			count = qualified_count;
+		}
+		if (count > 0 || current_buffer_pos >= data_size) {
+			break;
+		}
+		stats.AddTime(CsvScanCounter::CONVERT_TIME, tokenized);
+	}
+	for (auto column_idx : materialized_columns) {
+		auto &out_vec = chunk.data[projection_map[column_idx]];
+		converters[column_idx].ConvertColumn(data_ptr, column_field_starts[column_idx].data(),
+		                                     column_field_lengths[column_idx].data(), sel, count, out_vec);
+	}
+	chunk.SetCardinality(num_rows);
+	if (count < num_rows) {
+		// The rows rejected by the filters are dropped by a selection instead of moving the values
+		chunk.Slice(sel, count);
 	}
+	stats.AddTime(CsvScanCounter::CONVERT_TIME, tokenized);
 }
 
 } // namespace duckdb